@@ -0,0 +1,93 @@
+#include "AllocationTracker.hpp"
+#include <cstdlib>
+#include <new>
+
+using namespace std;
+
+namespace {
+
+AllocationBucket current_bucket = ALLOC_OTHER;
+AllocationCount counts[NUM_ALLOCATION_BUCKETS];
+
+const char * const BUCKET_NAMES[NUM_ALLOCATION_BUCKETS] = {
+  "Other",
+  "Game bookkeeping",
+  "Pack",
+  "Player::add_card",
+  "Player::add_and_discard",
+  "Player::make_trump",
+  "Player::lead_card",
+  "Player::play_card",
+  "Player notifications",
+};
+
+// EFFECTS: Counts an allocation of size bytes in the current bucket
+void count_allocation(size_t size) {
+  counts[current_bucket].allocations++;
+  counts[current_bucket].bytes += size;
+}
+
+} // namespace
+
+AllocationCount allocation_count(AllocationBucket bucket) {
+  return counts[bucket];
+}
+
+void reset_allocation_counts() {
+  for (AllocationCount &count : counts) {
+    count = { 0, 0 };
+  }
+}
+
+const char * allocation_bucket_name(AllocationBucket bucket) {
+  return BUCKET_NAMES[bucket];
+}
+
+AllocationScope::AllocationScope(AllocationBucket bucket)
+  : outer(current_bucket) {
+  current_bucket = bucket;
+}
+
+AllocationScope::~AllocationScope() {
+  current_bucket = outer;
+}
+
+// Every allocation of the program comes through one of these two: the
+// second is for types aligned past what malloc guarantees.  The array,
+// nothrow and sized forms from the standard library all call one of them.
+void * operator new(size_t size) {
+  count_allocation(size);
+  void *memory = malloc(size > 0 ? size : 1);
+  if (!memory) {
+    throw bad_alloc();
+  }
+  return memory;
+}
+
+void * operator new(size_t size, align_val_t alignment) {
+  count_allocation(size);
+  size_t align = static_cast<size_t>(alignment);
+  // aligned_alloc wants a size that is a multiple of the alignment
+  size_t rounded = size > 0 ? (size + align - 1) / align * align : align;
+  void *memory = aligned_alloc(align, rounded);
+  if (!memory) {
+    throw bad_alloc();
+  }
+  return memory;
+}
+
+void operator delete(void *memory) noexcept {
+  free(memory);
+}
+
+void operator delete(void *memory, size_t) noexcept {
+  free(memory);
+}
+
+void operator delete(void *memory, align_val_t) noexcept {
+  free(memory);
+}
+
+void operator delete(void *memory, size_t, align_val_t) noexcept {
+  free(memory);
+}
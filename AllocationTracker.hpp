@@ -0,0 +1,67 @@
+#ifndef ALLOCATIONTRACKER_HPP
+#define ALLOCATIONTRACKER_HPP
+/* AllocationTracker.hpp
+ *
+ * Opt-in counting of heap allocations, for finding out which part of a
+ * simulation is churning the allocator.  Built with TRACK_ALLOCATIONS
+ * defined and AllocationTracker.cpp linked in (see alloc_report.exe in the
+ * Makefile), every operator new, over-aligned forms included, is counted,
+ * along with its bytes, in the bucket of the innermost ALLOCATION_SCOPE
+ * around it.  Game puts a scope around each call into the Pack and each
+ * call into a Player; anything else during a game is Game bookkeeping.
+ *
+ * Without TRACK_ALLOCATIONS, ALLOCATION_SCOPE is empty and nothing here is
+ * compiled in.  The counts are plain globals, so only track programs that
+ * allocate from a single thread.
+ */
+
+enum AllocationBucket {
+  ALLOC_OTHER,           // outside every scope
+  ALLOC_GAME,            // Game bookkeeping
+  ALLOC_PACK,            // Pack shuffles and deals
+  ALLOC_ADD_CARD,        // Player::add_card
+  ALLOC_ADD_AND_DISCARD, // Player::add_and_discard
+  ALLOC_MAKE_TRUMP,      // Player::make_trump
+  ALLOC_LEAD_CARD,       // Player::lead_card
+  ALLOC_PLAY_CARD,       // Player::play_card
+  ALLOC_NOTIFY,          // Player::start_hand, trump_made and card_played
+  NUM_ALLOCATION_BUCKETS
+};
+
+struct AllocationCount {
+  long long allocations;
+  long long bytes;
+};
+
+// EFFECTS: Returns what has been allocated in bucket since the last reset
+AllocationCount allocation_count(AllocationBucket bucket);
+
+// EFFECTS: Sets every bucket's count back to zero
+void reset_allocation_counts();
+
+// EFFECTS: Returns the name of bucket, for example "Player::add_card"
+const char * allocation_bucket_name(AllocationBucket bucket);
+
+// Counts allocations in a bucket for as long as it lives
+class AllocationScope {
+public:
+  // EFFECTS: Counts allocations in bucket until destroyed
+  explicit AllocationScope(AllocationBucket bucket);
+
+  // EFFECTS: Goes back to counting in the bucket from before
+  ~AllocationScope();
+
+  AllocationScope(const AllocationScope &) = delete;
+  AllocationScope & operator=(const AllocationScope &) = delete;
+
+private:
+  AllocationBucket outer;
+};
+
+#ifdef TRACK_ALLOCATIONS
+#define ALLOCATION_SCOPE(bucket) AllocationScope allocation_scope(bucket)
+#else
+#define ALLOCATION_SCOPE(bucket)
+#endif
+
+#endif // ALLOCATIONTRACKER_HPP
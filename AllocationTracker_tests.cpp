@@ -0,0 +1,139 @@
+#include "AllocationTracker.hpp"
+#include "Game.hpp"
+#include "Player.hpp"
+#include "unit_test_framework.hpp"
+#include <cstdint>
+#include <iostream>
+#include <memory>
+#include <string>
+#include <vector>
+
+using namespace std;
+
+//allocations land in the innermost scope, and leaving it goes back out
+TEST(test_allocation_scopes) {
+    reset_allocation_counts();
+    {
+        ALLOCATION_SCOPE(ALLOC_GAME);
+        unique_ptr<char[]> game(new char[100]);
+        {
+            ALLOCATION_SCOPE(ALLOC_PACK);
+            unique_ptr<int> pack(new int(1));
+            unique_ptr<int> again(new int(2));
+        }
+        unique_ptr<char[]> more(new char[10]);
+    }
+    ASSERT_EQUAL(allocation_count(ALLOC_GAME).allocations, 2);
+    ASSERT_EQUAL(allocation_count(ALLOC_GAME).bytes, 110);
+    ASSERT_EQUAL(allocation_count(ALLOC_PACK).allocations, 2);
+    ASSERT_EQUAL(allocation_count(ALLOC_PACK).bytes,
+                 static_cast<long long>(2 * sizeof(int)));
+
+    reset_allocation_counts();
+    ASSERT_EQUAL(allocation_count(ALLOC_GAME).allocations, 0);
+    ASSERT_EQUAL(allocation_count(ALLOC_PACK).bytes, 0);
+}
+
+//over-aligned types take the aligned operator new, which is counted too
+TEST(test_allocation_aligned) {
+    struct alignas(64) Line {
+        char bytes[64];
+    };
+    reset_allocation_counts();
+    {
+        ALLOCATION_SCOPE(ALLOC_PACK);
+        unique_ptr<Line> line(new Line);
+        unique_ptr<Line[]> lines(new Line[3]);
+        ASSERT_EQUAL(reinterpret_cast<uintptr_t>(line.get()) % 64, 0u);
+        ASSERT_EQUAL(reinterpret_cast<uintptr_t>(lines.get()) % 64, 0u);
+    }
+    ASSERT_EQUAL(allocation_count(ALLOC_PACK).allocations, 2);
+    ASSERT_EQUAL(allocation_count(ALLOC_PACK).bytes, 4 * 64);
+}
+
+TEST(test_allocation_bucket_names) {
+    ASSERT_EQUAL(string(allocation_bucket_name(ALLOC_PACK)), "Pack");
+    ASSERT_EQUAL(string(allocation_bucket_name(ALLOC_PLAY_CARD)),
+                 "Player::play_card");
+}
+
+//a game of Simple players allocates nothing in the Pack or the players,
+//only its own copy of the seats
+TEST(test_allocation_simple_game) {
+    vector<Player*> players;
+    for (int seat = 0; seat < 4; ++seat) {
+        players.push_back(Player_factory("Adi", "Simple"));
+    }
+    NullSink out;
+    ShuffleSetting shuffle = { ShuffleSetting::RANDOM, 280, 0 };
+    reset_allocation_counts();
+    {
+        ALLOCATION_SCOPE(ALLOC_GAME);
+        Game game({ Pack(), shuffle, 10 }, players, out);
+        game.play();
+    }
+    for (int b = ALLOC_PACK; b < NUM_ALLOCATION_BUCKETS; ++b) {
+        ASSERT_EQUAL(
+            allocation_count(static_cast<AllocationBucket>(b)).allocations,
+            0);
+    }
+    ASSERT_EQUAL(allocation_count(ALLOC_GAME).allocations, 1);
+    for (Player *player : players) {
+        delete player;
+    }
+}
+
+//a player that allocates while it decides is caught in the right bucket
+class Hoarder : public Player {
+public:
+    const string & get_name() const override {
+        return name;
+    }
+    void add_card(const Card &c) override {
+        hand.push_back(c);
+    }
+    bool make_trump(const Card &, bool, int, Suit &) const override {
+        return false;
+    }
+    void add_and_discard(const Card &) override {}
+    Card lead_card(Suit) override {
+        return take(0);
+    }
+    Card play_card(const Card &, Suit) override {
+        // Keeps a copy of the hand for no reason
+        vector<Card> copy = hand;
+        return take(0);
+    }
+
+private:
+    string name = "Hoarder";
+    vector<Card> hand;
+
+    Card take(int index) {
+        Card card = hand[index];
+        hand.erase(hand.begin() + index);
+        return card;
+    }
+};
+
+TEST(test_allocation_player_buckets) {
+    vector<Player*> players;
+    for (int seat = 0; seat < 4; ++seat) {
+        players.push_back(new Hoarder);
+    }
+    NullSink out;
+    ShuffleSetting shuffle = { ShuffleSetting::NO_SHUFFLE, 0, 0 };
+    reset_allocation_counts();
+    Game game({ Pack(), shuffle, 1 }, players, out);
+    game.play();
+    ASSERT_TRUE(allocation_count(ALLOC_ADD_CARD).allocations > 0);
+    ASSERT_TRUE(allocation_count(ALLOC_PLAY_CARD).allocations > 0);
+    ASSERT_EQUAL(allocation_count(ALLOC_LEAD_CARD).allocations, 0);
+    ASSERT_EQUAL(allocation_count(ALLOC_MAKE_TRUMP).allocations, 0);
+    ASSERT_EQUAL(allocation_count(ALLOC_PACK).allocations, 0);
+    for (Player *player : players) {
+        delete player;
+    }
+}
+
+TEST_MAIN()
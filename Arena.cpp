@@ -0,0 +1,61 @@
+#include "Arena.hpp"
+#include <algorithm>
+#include <cassert>
+
+using namespace std;
+
+Arena::Arena(size_t block_size_in)
+  : current(0), used(0), cleanups(nullptr) {
+  assert(block_size_in > 0);
+  blocks.push_back({ make_unique<unsigned char[]>(block_size_in),
+                     block_size_in });
+}
+
+Arena::~Arena() {
+  reset();
+}
+
+void Arena::reset() {
+  for (Cleanup *cleanup = cleanups; cleanup; cleanup = cleanup->next) {
+    cleanup->destroy(cleanup->object);
+  }
+  cleanups = nullptr;
+  current = 0;
+  used = 0;
+}
+
+size_t Arena::bytes_used() const {
+  size_t total = used;
+  for (size_t i = 0; i < current; ++i) {
+    total += blocks[i].size;
+  }
+  return total;
+}
+
+size_t Arena::capacity() const {
+  size_t total = 0;
+  for (const Block &block : blocks) {
+    total += block.size;
+  }
+  return total;
+}
+
+void * Arena::allocate_slow(size_t size, size_t align) {
+  // Blocks are new[]ed, so their starts are aligned for anything
+  assert(align <= alignof(max_align_t));
+  // The rest of the current block is given up, as it would be on overflow
+  // anyway; a block kept from before the last reset may still be too small
+  while (++current < blocks.size()) {
+    if (size <= blocks[current].size) {
+      used = size;
+      return blocks[current].data.get();
+    }
+  }
+  // Each new block at least doubles the arena, so growing stays rare
+  size_t block_size = max({ size, blocks.back().size * 2,
+                            DEFAULT_BLOCK_SIZE });
+  blocks.push_back({ make_unique<unsigned char[]>(block_size), block_size });
+  current = blocks.size() - 1;
+  used = size;
+  return blocks[current].data.get();
+}
@@ -0,0 +1,108 @@
+#ifndef ARENA_HPP
+#define ARENA_HPP
+/* Arena.hpp
+ *
+ * A bump allocator for objects that all die together.  make() places an
+ * object in the current block by moving a pointer, and reset() destroys
+ * every object made since the last reset, newest first, and rewinds to the
+ * start of the first block.  Blocks are kept across resets, so once an
+ * arena has grown to the size a workload needs, filling it again never
+ * touches the heap.
+ *
+ * An Arena is not thread-safe; give each thread its own.
+ */
+
+#include <cstddef>
+#include <memory>
+#include <new>
+#include <utility>
+#include <vector>
+
+class Arena {
+public:
+  // Size of the first block, and the smallest size of any later one
+  static const std::size_t DEFAULT_BLOCK_SIZE = 1 << 16;
+
+  //REQUIRES block_size_in > 0
+  //EFFECTS Initializes an empty arena whose first block holds
+  //  block_size_in bytes
+  explicit Arena(std::size_t block_size_in = DEFAULT_BLOCK_SIZE);
+
+  Arena(const Arena &) = delete;
+  Arena & operator=(const Arena &) = delete;
+
+  //EFFECTS Destroys every object in the arena and frees its blocks
+  ~Arena();
+
+  //REQUIRES align is a power of two no larger than alignof(max_align_t)
+  //MODIFIES this
+  //EFFECTS Returns size bytes aligned to align, valid until the next reset
+  void * allocate(std::size_t size, std::size_t align) {
+    std::size_t start = (used + align - 1) & ~(align - 1);
+    if (start + size > blocks[current].size) {
+      return allocate_slow(size, align);
+    }
+    used = start + size;
+    return blocks[current].data.get() + start;
+  }
+
+  //MODIFIES this
+  //EFFECTS Constructs a T from args in the arena and returns it.  The
+  //  object is destroyed by the next reset, and must not be deleted.
+  template <typename T, typename... Args>
+  T * make(Args&&... args) {
+    static_assert(alignof(T) <= alignof(std::max_align_t),
+                  "blocks are only aligned for max_align_t");
+    // The record that destroys the object goes right in front of it
+    Cleanup *cleanup = static_cast<Cleanup*>(
+      allocate(sizeof(Cleanup), alignof(Cleanup)));
+    T *object = new (allocate(sizeof(T), alignof(T)))
+      T(std::forward<Args>(args)...);
+    cleanup->destroy = &destroy<T>;
+    cleanup->object = object;
+    cleanup->next = cleanups;
+    cleanups = cleanup;
+    return object;
+  }
+
+  //MODIFIES this
+  //EFFECTS Destroys every object made since the last reset, newest first,
+  //  and makes all of the arena's memory free again
+  void reset();
+
+  //EFFECTS Returns the bytes handed out since the last reset, padding
+  //  included
+  std::size_t bytes_used() const;
+
+  //EFFECTS Returns the bytes of all the arena's blocks
+  std::size_t capacity() const;
+
+private:
+  struct Block {
+    std::unique_ptr<unsigned char[]> data;
+    std::size_t size;
+  };
+
+  struct Cleanup {
+    void (*destroy)(void *object);
+    void *object;
+    Cleanup *next;
+  };
+
+  std::vector<Block> blocks;
+  std::size_t current; // block being filled
+  std::size_t used;    // bytes of blocks[current] handed out
+  Cleanup *cleanups;   // newest first
+
+  template <typename T>
+  static void destroy(void *object) {
+    static_cast<T*>(object)->~T();
+  }
+
+  //MODIFIES this
+  //EFFECTS Moves on to the next block with room for size bytes, adding
+  //  one if there is none, and returns them
+  void * allocate_slow(std::size_t size, std::size_t align);
+};
+
+#endif // ARENA_HPP
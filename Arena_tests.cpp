@@ -0,0 +1,109 @@
+#include "Arena.hpp"
+#include "Player.hpp"
+#include "unit_test_framework.hpp"
+#include <cstddef>
+#include <cstdint>
+#include <iostream>
+#include <string>
+#include <vector>
+
+using namespace std;
+
+//records the order objects are destroyed in
+struct Tracked {
+    Tracked(vector<int> &destroyed_in, int id_in)
+      : destroyed(destroyed_in), id(id_in) {}
+    ~Tracked() {
+        destroyed.push_back(id);
+    }
+    vector<int> &destroyed;
+    int id;
+};
+
+struct alignas(alignof(max_align_t)) Wide {
+    char bytes[40];
+};
+
+TEST(test_arena_alignment) {
+    Arena arena(256);
+    for (int i = 0; i < 20; ++i) {
+        char *c = arena.make<char>('x');
+        Wide *wide = arena.make<Wide>();
+        double *d = arena.make<double>(1.5);
+        ASSERT_EQUAL(*c, 'x');
+        ASSERT_EQUAL(*d, 1.5);
+        ASSERT_EQUAL(reinterpret_cast<uintptr_t>(wide) % alignof(Wide), 0u);
+        ASSERT_EQUAL(reinterpret_cast<uintptr_t>(d) % alignof(double), 0u);
+    }
+}
+
+//reset destroys everything, newest first, and only once
+TEST(test_arena_reset_destroys) {
+    vector<int> destroyed;
+    {
+        Arena arena;
+        for (int id = 0; id < 3; ++id) {
+            arena.make<Tracked>(destroyed, id);
+        }
+        arena.reset();
+        ASSERT_EQUAL(destroyed.size(), 3u);
+        ASSERT_EQUAL(destroyed[0], 2);
+        ASSERT_EQUAL(destroyed[2], 0);
+        arena.make<Tracked>(destroyed, 3);
+    }
+    ASSERT_EQUAL(destroyed.size(), 4u);
+    ASSERT_EQUAL(destroyed[3], 3);
+}
+
+//after a reset the same memory is handed out again, even past the first
+//block, so refilling the arena does not grow it
+TEST(test_arena_reuses_memory) {
+    Arena arena(128);
+    vector<int*> first;
+    for (int i = 0; i < 100; ++i) {
+        first.push_back(arena.make<int>(i));
+    }
+    size_t capacity = arena.capacity();
+    ASSERT_TRUE(capacity > 128);
+    ASSERT_TRUE(arena.bytes_used() >= 100 * sizeof(int));
+
+    arena.reset();
+    ASSERT_EQUAL(arena.bytes_used(), 0u);
+    for (int i = 0; i < 100; ++i) {
+        ASSERT_EQUAL(arena.make<int>(i), first[i]);
+    }
+    ASSERT_EQUAL(arena.capacity(), capacity);
+    for (int i = 0; i < 100; ++i) {
+        ASSERT_EQUAL(*first[i], i);
+    }
+}
+
+//an object bigger than a whole block gets a block of its own
+TEST(test_arena_large_object) {
+    Arena arena(64);
+    arena.make<int>(1);
+    vector<char> *big = arena.make<vector<char>>(10, 'y');
+    char *chunk = static_cast<char*>(arena.allocate(1000, 1));
+    chunk[999] = 'z';
+    ASSERT_EQUAL((*big)[9], 'y');
+    ASSERT_TRUE(arena.capacity() >= 1064);
+}
+
+//players made in an arena work like the ones from new
+TEST(test_arena_player_factory) {
+    Arena arena;
+    const string strategies[] = { "Simple", "MonteCarlo:2", "ISMCTS:10" };
+    for (const string &strategy : strategies) {
+        Player *player = Player_factory("Adi", strategy, arena);
+        ASSERT_EQUAL(player->get_name(), "Adi");
+        player->add_card(Card(NINE, SPADES));
+        player->add_card(Card(JACK, HEARTS));
+        player->start_hand(0, 3, Card(TEN, CLUBS));
+        player->trump_made(1, HEARTS, 2);
+        Card led = player->lead_card(HEARTS);
+        ASSERT_TRUE(led == Card(NINE, SPADES) || led == Card(JACK, HEARTS));
+    }
+    arena.reset();
+}
+
+TEST_MAIN()
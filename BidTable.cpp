@@ -0,0 +1,98 @@
+#include "BidTable.hpp"
+#include "HandRank.hpp"
+#include "PackedCard.hpp"
+#include <array>
+#include <cassert>
+#include <cstdint>
+
+using namespace std;
+
+namespace {
+
+const int NUM_HANDS = num_hands(BID_TABLE_HAND_SIZE);
+const int ROUND_2_SHIFT = 4;
+
+typedef array<uint8_t, NUM_HANDS> BidTable;
+
+// EFFECTS: Returns the bits of the trump cards, left bower included
+constexpr uint32_t trump_bits(Suit trump) {
+  uint32_t suit = 0x3Fu << (trump * PackedCard::CARDS_PER_SUIT);
+  return suit | 1u << PackedCard(JACK, PackedCard::next_suit(trump)).index();
+}
+
+// EFFECTS: Returns Simple's bids for every hand, see BidTable.hpp
+BidTable make_bid_table() {
+  BidTable table = {};
+  uint32_t hand = hand_rank_detail::unrank_bits(0, BID_TABLE_HAND_SIZE);
+  for (int rank = 0; rank < NUM_HANDS; ++rank) {
+    uint32_t faces = hand & cardset_detail::FACE_OR_ACE_MASK;
+    uint8_t entry = 0;
+    for (int s = SPADES; s <= DIAMONDS; ++s) {
+      Suit upcard_suit = static_cast<Suit>(s);
+      Suit next = PackedCard::next_suit(upcard_suit);
+      if (__builtin_popcount(faces & trump_bits(upcard_suit)) >= 2) {
+        entry |= 1u << s;
+      }
+      if (__builtin_popcount(faces & trump_bits(next)) >= 1) {
+        entry |= 1u << (ROUND_2_SHIFT + s);
+      }
+    }
+    table[rank] = entry;
+    hand = hand_rank_detail::next_bits(hand);
+  }
+  return table;
+}
+
+// EFFECTS: Returns Simple's bids for every hand, built on first use so that
+//          objects initialized before this file's statics still see the
+//          whole table.  Building it at compile time would take more
+//          constexpr evaluation steps than compilers allow by default.
+const BidTable & simple_bids() {
+  static const BidTable table = make_bid_table();
+  return table;
+}
+
+// EFFECTS: Writes the suits whose bits are set in entry >> shift to out
+void write_suits(OutputSink &out, uint8_t entry, int shift) {
+  bool any = false;
+  for (int s = SPADES; s <= DIAMONDS; ++s) {
+    if (entry >> (shift + s) & 1) {
+      out << (any ? " " : "") << static_cast<Suit>(s);
+      any = true;
+    }
+  }
+  if (!any) {
+    out << '-';
+  }
+}
+
+} // namespace
+
+bool simple_orders_up(CardSet hand, Suit upcard_suit, bool is_dealer,
+                      int round) {
+  assert(hand.size() == BID_TABLE_HAND_SIZE);
+  assert(round == 1 || round == 2);
+  if (round == 2 && is_dealer) {
+    return true;
+  }
+  int shift = round == 1 ? 0 : ROUND_2_SHIFT;
+  return simple_bids()[hand_rank(hand)] >> (shift + upcard_suit) & 1;
+}
+
+void write_simple_bids(OutputSink &out) {
+  CardSet hand = first_hand(BID_TABLE_HAND_SIZE);
+  for (int rank = 0; rank < NUM_HANDS; ++rank) {
+    out << rank << ": ";
+    for (uint32_t bits = hand.bits(); bits; bits &= bits - 1) {
+      out << PackedCard(__builtin_ctz(bits)) << (bits & (bits - 1) ? ", " : "");
+    }
+    out << " | round 1: ";
+    write_suits(out, simple_bids()[rank], 0);
+    out << " | round 2: ";
+    write_suits(out, simple_bids()[rank], ROUND_2_SHIFT);
+    out << '\n';
+    if (rank + 1 < NUM_HANDS) {
+      hand = next_hand(hand);
+    }
+  }
+}
@@ -0,0 +1,37 @@
+#ifndef BIDTABLE_HPP
+#define BIDTABLE_HPP
+/* BidTable.hpp
+ *
+ * Every bidding decision of the Simple strategy for a full hand, worked out
+ * once, the first time a bid is looked up.  Simple orders up the upcard's
+ * suit in round 1 with two or more trump face cards (Jack, Queen, King or
+ * Ace, left bower included), and in round 2 orders up the suit of the same
+ * color as the upcard with one or more, or always as the dealer.  Apart from
+ * the dealer rule that only depends on the hand and the upcard's suit, so
+ * the table has one byte per 5-card hand, indexed by the hand's rank (see
+ * HandRank.hpp): bit s says whether round 1 orders up when the upcard's suit
+ * is s, and bit 4 + s the same for round 2.
+ */
+
+#include "Card.hpp"
+#include "CardSet.hpp"
+#include "OutputSink.hpp"
+
+// Number of cards in the hands the table covers
+const int BID_TABLE_HAND_SIZE = 5;
+
+// REQUIRES: hand has BID_TABLE_HAND_SIZE cards, round is 1 or 2
+// EFFECTS: Returns true if a Simple player holding hand orders up in round
+//          when the upcard's suit is upcard_suit
+bool simple_orders_up(CardSet hand, Suit upcard_suit, bool is_dealer,
+                      int round);
+
+// MODIFIES: out
+// EFFECTS: Writes the whole table to out, one hand per line in rank order:
+//          the rank, the cards, then the upcard suits for which Simple
+//          orders up in round 1, and those for which it orders up in round
+//          2 when it is not the dealer.  For example
+//          "57: Nine of Spades, ... | round 1: Spades | round 2: -"
+void write_simple_bids(OutputSink &out);
+
+#endif // BIDTABLE_HPP
@@ -0,0 +1,60 @@
+#include "BidTable.hpp"
+#include "HandRank.hpp"
+#include "unit_test_framework.hpp"
+#include <iostream>
+#include <sstream>
+#include <string>
+
+using namespace std;
+
+//counts trump face cards one Card at a time, the way Simple used to
+int trump_faces(CardSet hand, Suit trump) {
+    int count = 0;
+    for (Card card : hand) {
+        if (card.is_face_or_ace() && card.get_suit(trump) == trump) {
+            ++count;
+        }
+    }
+    return count;
+}
+
+//every hand in rank order, from the first bitboard of five cards up
+TEST(test_bid_table_matches_counting) {
+    int rank = 0;
+    for (uint32_t bits = 0; bits < 1u << CardSet::NUM_CARDS; ++bits) {
+        if (__builtin_popcount(bits) != BID_TABLE_HAND_SIZE) {
+            continue;
+        }
+        CardSet hand(bits);
+        ASSERT_EQUAL(rank++, hand_rank(hand));
+        for (int s = SPADES; s <= DIAMONDS; ++s) {
+            Suit suit = static_cast<Suit>(s);
+            bool round1 = trump_faces(hand, suit) >= 2;
+            bool round2 = trump_faces(hand, Suit_next(suit)) >= 1;
+            ASSERT_EQUAL(round1, simple_orders_up(hand, suit, false, 1));
+            ASSERT_EQUAL(round1, simple_orders_up(hand, suit, true, 1));
+            ASSERT_EQUAL(round2, simple_orders_up(hand, suit, false, 2));
+            ASSERT_TRUE(simple_orders_up(hand, suit, true, 2));
+        }
+    }
+    ASSERT_EQUAL(num_hands(BID_TABLE_HAND_SIZE), rank);
+}
+
+//one line per hand, starting with the lowest
+TEST(test_bid_table_export) {
+    MemorySink out;
+    write_simple_bids(out);
+    istringstream lines(out.str());
+    string line;
+    int count = 0;
+    while (getline(lines, line)) {
+        ++count;
+    }
+    ASSERT_EQUAL(num_hands(BID_TABLE_HAND_SIZE), count);
+    string first = out.str().substr(0, out.str().find('\n'));
+    ASSERT_EQUAL("0: Nine of Spades, Ten of Spades, Jack of Spades, "
+                 "Queen of Spades, King of Spades | round 1: Spades | "
+                 "round 2: Spades Clubs", first);
+}
+
+TEST_MAIN()
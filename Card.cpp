@@ -2,6 +2,8 @@
 #include <iostream>
 #include <array>
 #include "Card.hpp"
+#include "PackedCard.hpp"
+#include "TrumpOrder.hpp"
 
 using namespace std;
 
@@ -155,6 +157,11 @@ bool Card::is_trump(Suit trump) const{
 
 
 ostream & operator<<(ostream &os, const Card &card){
+  // Euchre cards have a precomputed name, printed in one piece
+  if (card.get_rank() >= NINE) {
+    os << PackedCard(card).name();
+    return os;
+  }
   os << card.get_rank() << " of " << card.get_suit();
   return os;
 }
@@ -237,44 +244,15 @@ bool operator!=(const Card &lhs, const Card &rhs){
 //   operator==
 //   operator!=
 
-// Helper function for both Card_less versions
-bool Card_less_helper(const Card &a, const Card &b, Suit trump) {
-    // Handle bower cases first
-    if (a.is_right_bower(trump)) return false;
-    if (b.is_right_bower(trump)) return true;
-    if (a.is_left_bower(trump)) return false;
-    if (b.is_left_bower(trump)) return true;
-
-    // Then handle trump vs non-trump
-    if (a.get_suit(trump) == trump && b.get_suit(trump) != trump) return false;
-    if (a.get_suit(trump) != trump && b.get_suit(trump) == trump) return true;
-
-    // If both are trump or both are not trump, compare ranks
-    if (a.get_suit(trump) == b.get_suit(trump)) {
-        return a.get_rank() < b.get_rank();
-    }
-    
-    return false; // Default case
-}
-
+// Trick order is precomputed in TrumpOrder.hpp for every trump and led suit
 bool Card_less(const Card &a, const Card &b, const Card &led_card, Suit trump) {
-    // Use helper function for common logic
-    bool result = Card_less_helper(a, b, trump);
-    
-    // Only add led card specific logic if not already determined
-    if (a.get_suit(trump) != b.get_suit(trump) && 
-        !a.is_trump(trump) && !b.is_trump(trump)) {
-        
-        // If one of the cards follows the led suit but neither is trump
-        if (a.get_suit(trump) == led_card.get_suit(trump)) return false;
-        if (b.get_suit(trump) == led_card.get_suit(trump)) return true;
-    }
-    
-    return result;
+    Suit led_suit = led_card.get_suit(trump);
+    return trick_strength(a, led_suit, trump) < trick_strength(b, led_suit, trump);
 }
 
+// Trump order is precomputed in TrumpOrder.hpp, so this is one compare
 bool Card_less(const Card &a, const Card &b, Suit trump) {
-    return Card_less_helper(a, b, trump);
+    return trump_strength(a, trump) < trump_strength(b, trump);
 }
 
 Suit Suit_next(Suit suit){
@@ -0,0 +1,345 @@
+#ifndef CARDSET_HPP
+#define CARDSET_HPP
+/* CardSet.hpp
+ *
+ * Represents a set of euchre cards as a 24-bit bitboard.  Bit i is the
+ * card at position i of the standard Pack order (Nine of Spades is bit 0,
+ * Ace of Diamonds is bit 23), so insert, erase and suit counts are single
+ * bit operations and no heap memory is ever used.
+ */
+
+#include "Card.hpp"
+#include "PackedCard.hpp"
+#include <cstdint>
+
+class CardSet {
+public:
+  // Number of distinct cards in a euchre pack
+  static const int NUM_CARDS = PackedCard::NUM_CARDS;
+
+  // Number of cards of each suit in a euchre pack (Nine through Ace)
+  static const int CARDS_PER_SUIT = PackedCard::CARDS_PER_SUIT;
+
+  //EFFECTS Initializes an empty set
+  CardSet();
+
+  //REQUIRES bits_in uses only the low NUM_CARDS bits
+  //EFFECTS Initializes the set from a bitboard, bit i is the card at index i
+  explicit CardSet(uint32_t bits_in);
+
+  //REQUIRES card is a euchre card (Nine or higher)
+  //EFFECTS Returns the position of card in the standard Pack order, 0..23
+  static int index_of(const Card &card);
+
+  //REQUIRES 0 <= index < NUM_CARDS
+  //EFFECTS Returns the card at position index of the standard Pack order
+  static Card card_at(int index);
+
+  //EFFECTS Returns every card of suit s.  Does not consider trump.
+  static CardSet of_suit(Suit s);
+
+  //EFFECTS Returns every card whose suit is s when trump is the trump suit.
+  //  The left bower belongs to the trump suit, not to its printed suit.
+  static CardSet of_suit(Suit s, Suit trump);
+
+  //EFFECTS Returns every trump card, including the left bower
+  static CardSet trump_cards(Suit trump);
+
+  //EFFECTS Returns every Jack, Queen, King and Ace
+  static CardSet face_or_ace();
+
+  //EFFECTS Returns the underlying bitboard
+  uint32_t bits() const;
+
+  //EFFECTS Returns true if the set has no cards
+  bool empty() const;
+
+  //EFFECTS Returns the number of cards in the set
+  int size() const;
+
+  //EFFECTS Returns the number of cards whose suit is s when trump is trump
+  int count(Suit s, Suit trump) const;
+
+  //REQUIRES card is a euchre card
+  //EFFECTS Returns true if card is in the set
+  bool contains(const Card &card) const;
+
+  //REQUIRES card is a euchre card
+  //MODIFIES this
+  //EFFECTS Adds card to the set.  Adding a card twice has no effect.
+  void insert(const Card &card);
+
+  //REQUIRES card is a euchre card
+  //MODIFIES this
+  //EFFECTS Removes card from the set, if present
+  void erase(const Card &card);
+
+  //REQUIRES set is not empty
+  //EFFECTS Returns the lowest card, using operator< (does not consider trump)
+  Card lowest() const;
+
+  //REQUIRES set is not empty
+  //EFFECTS Returns the highest card, using operator< (does not consider trump)
+  Card highest() const;
+
+  //REQUIRES set is not empty
+  //EFFECTS Returns the lowest card in trump order: every non-trump card is
+  //  below every trump card, non-trump cards are ordered with operator<, and
+  //  the left and right bowers are the two highest trump cards.
+  Card lowest(Suit trump) const;
+
+  //REQUIRES set is not empty
+  //EFFECTS Returns the highest card in trump order (see lowest(Suit))
+  Card highest(Suit trump) const;
+
+  //REQUIRES 0 <= n < size()
+  //EFFECTS Returns the n-th card of the set in operator< order, which is the
+  //  order a sorted vector<Card> of the same cards would have.
+  Card nth(int n) const;
+
+  // Iterates over the cards of a set in operator< order
+  class Iterator {
+  public:
+    explicit Iterator(uint32_t remaining_in);
+    Card operator*() const;
+    Iterator & operator++();
+    bool operator!=(const Iterator &other) const;
+  private:
+    uint32_t remaining;
+  };
+
+  //EFFECTS Returns an iterator to the lowest card in operator< order
+  Iterator begin() const;
+
+  //EFFECTS Returns the past-the-end iterator
+  Iterator end() const;
+
+private:
+  uint32_t bits_;
+
+  //EFFECTS Returns the bit of card in the bitboard
+  static uint32_t bit_of(const Card &card);
+
+  //EFFECTS Returns the bit of the Jack of the suit of the same color as trump
+  static uint32_t left_bower_bit(Suit trump);
+
+  //EFFECTS Returns the bit of the Jack of trump
+  static uint32_t right_bower_bit(Suit trump);
+
+  //REQUIRES bits is not zero
+  //EFFECTS Returns the index of the lowest card of bits in operator< order
+  static int lowest_index(uint32_t bits);
+
+  //REQUIRES bits is not zero
+  //EFFECTS Returns the index of the highest card of bits in operator< order
+  static int highest_index(uint32_t bits);
+};
+
+//EFFECTS Returns the cards that are in either set
+CardSet operator|(CardSet lhs, CardSet rhs);
+
+//EFFECTS Returns the cards that are in both sets
+CardSet operator&(CardSet lhs, CardSet rhs);
+
+//EFFECTS Returns the cards of lhs that are not in rhs
+CardSet operator-(CardSet lhs, CardSet rhs);
+
+//EFFECTS Returns true if both sets hold the same cards
+bool operator==(CardSet lhs, CardSet rhs);
+
+
+/////////////// Inline implementation ///////////////
+// Everything below is a handful of bit operations, so it is defined in the
+// header where the compiler can inline it into the Player strategies.
+
+namespace cardset_detail {
+  // One bit per suit at the given rank offset (Nine of each suit)
+  const uint32_t RANK_MASK = 0x041041;
+  // The six cards of the lowest suit
+  const uint32_t SUIT_MASK = 0x3F;
+  // Jack, Queen, King and Ace of every suit
+  const uint32_t FACE_OR_ACE_MASK = 0xF3CF3C;
+}
+
+inline CardSet::CardSet() : bits_(0) {}
+
+inline CardSet::CardSet(uint32_t bits_in) : bits_(bits_in) {}
+
+inline int CardSet::index_of(const Card &card) {
+  return PackedCard(card).index();
+}
+
+inline Card CardSet::card_at(int index) {
+  return PackedCard(index).to_card();
+}
+
+inline CardSet CardSet::of_suit(Suit s) {
+  return CardSet(cardset_detail::SUIT_MASK << (s * CARDS_PER_SUIT));
+}
+
+inline CardSet CardSet::of_suit(Suit s, Suit trump) {
+  uint32_t bits = of_suit(s).bits_;
+  if (s == trump) {
+    bits |= left_bower_bit(trump);
+  } else if (s == PackedCard::next_suit(trump)) {
+    bits &= ~left_bower_bit(trump);
+  }
+  return CardSet(bits);
+}
+
+inline CardSet CardSet::trump_cards(Suit trump) {
+  return of_suit(trump, trump);
+}
+
+inline CardSet CardSet::face_or_ace() {
+  return CardSet(cardset_detail::FACE_OR_ACE_MASK);
+}
+
+inline uint32_t CardSet::bits() const {
+  return bits_;
+}
+
+inline bool CardSet::empty() const {
+  return bits_ == 0;
+}
+
+inline int CardSet::size() const {
+  return __builtin_popcount(bits_);
+}
+
+inline int CardSet::count(Suit s, Suit trump) const {
+  return __builtin_popcount(bits_ & of_suit(s, trump).bits_);
+}
+
+inline bool CardSet::contains(const Card &card) const {
+  return (bits_ & bit_of(card)) != 0;
+}
+
+inline void CardSet::insert(const Card &card) {
+  bits_ |= bit_of(card);
+}
+
+inline void CardSet::erase(const Card &card) {
+  bits_ &= ~bit_of(card);
+}
+
+inline Card CardSet::lowest() const {
+  return card_at(lowest_index(bits_));
+}
+
+inline Card CardSet::highest() const {
+  return card_at(highest_index(bits_));
+}
+
+inline Card CardSet::lowest(Suit trump) const {
+  uint32_t trump_bits = trump_cards(trump).bits_;
+  uint32_t bowers = left_bower_bit(trump) | right_bower_bit(trump);
+  if (bits_ & ~trump_bits) {
+    return card_at(lowest_index(bits_ & ~trump_bits));
+  }
+  if (bits_ & ~bowers) {
+    return card_at(lowest_index(bits_ & ~bowers));
+  }
+  if (bits_ & left_bower_bit(trump)) {
+    return card_at(__builtin_ctz(left_bower_bit(trump)));
+  }
+  return card_at(__builtin_ctz(right_bower_bit(trump)));
+}
+
+inline Card CardSet::highest(Suit trump) const {
+  uint32_t trump_bits = trump_cards(trump).bits_;
+  if (!(bits_ & trump_bits)) {
+    return highest();
+  }
+  if (bits_ & right_bower_bit(trump)) {
+    return card_at(__builtin_ctz(right_bower_bit(trump)));
+  }
+  if (bits_ & left_bower_bit(trump)) {
+    return card_at(__builtin_ctz(left_bower_bit(trump)));
+  }
+  return card_at(highest_index(bits_ & trump_bits));
+}
+
+inline Card CardSet::nth(int n) const {
+  uint32_t remaining = bits_;
+  for (int i = 0; i < n; ++i) {
+    remaining &= ~(1u << lowest_index(remaining));
+  }
+  return card_at(lowest_index(remaining));
+}
+
+inline CardSet::Iterator::Iterator(uint32_t remaining_in)
+  : remaining(remaining_in) {}
+
+inline Card CardSet::Iterator::operator*() const {
+  return card_at(lowest_index(remaining));
+}
+
+inline CardSet::Iterator & CardSet::Iterator::operator++() {
+  remaining &= ~(1u << lowest_index(remaining));
+  return *this;
+}
+
+inline bool CardSet::Iterator::operator!=(const Iterator &other) const {
+  return remaining != other.remaining;
+}
+
+inline CardSet::Iterator CardSet::begin() const {
+  return Iterator(bits_);
+}
+
+inline CardSet::Iterator CardSet::end() const {
+  return Iterator(0);
+}
+
+inline uint32_t CardSet::bit_of(const Card &card) {
+  return 1u << index_of(card);
+}
+
+inline uint32_t CardSet::left_bower_bit(Suit trump) {
+  return 1u << PackedCard(JACK, PackedCard::next_suit(trump)).index();
+}
+
+inline uint32_t CardSet::right_bower_bit(Suit trump) {
+  return 1u << PackedCard(JACK, trump).index();
+}
+
+// operator< orders by rank first and suit second, so the lowest card is the
+// lowest suit among the lowest rank present
+inline int CardSet::lowest_index(uint32_t bits) {
+  for (int r = 0; r < CARDS_PER_SUIT; ++r) {
+    uint32_t at_rank = bits & (cardset_detail::RANK_MASK << r);
+    if (at_rank) {
+      return __builtin_ctz(at_rank);
+    }
+  }
+  return -1;
+}
+
+inline int CardSet::highest_index(uint32_t bits) {
+  for (int r = CARDS_PER_SUIT - 1; r >= 0; --r) {
+    uint32_t at_rank = bits & (cardset_detail::RANK_MASK << r);
+    if (at_rank) {
+      return 31 - __builtin_clz(at_rank);
+    }
+  }
+  return -1;
+}
+
+inline CardSet operator|(CardSet lhs, CardSet rhs) {
+  return CardSet(lhs.bits() | rhs.bits());
+}
+
+inline CardSet operator&(CardSet lhs, CardSet rhs) {
+  return CardSet(lhs.bits() & rhs.bits());
+}
+
+inline CardSet operator-(CardSet lhs, CardSet rhs) {
+  return CardSet(lhs.bits() & ~rhs.bits());
+}
+
+inline bool operator==(CardSet lhs, CardSet rhs) {
+  return lhs.bits() == rhs.bits();
+}
+
+#endif // CARDSET_HPP
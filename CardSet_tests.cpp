@@ -0,0 +1,89 @@
+#include "CardSet.hpp"
+#include "unit_test_framework.hpp"
+#include <iostream>
+
+using namespace std;
+
+//index
+TEST(test_index_pack_order) {
+    ASSERT_EQUAL(0, CardSet::index_of(Card(NINE, SPADES)));
+    ASSERT_EQUAL(5, CardSet::index_of(Card(ACE, SPADES)));
+    ASSERT_EQUAL(6, CardSet::index_of(Card(NINE, HEARTS)));
+    ASSERT_EQUAL(23, CardSet::index_of(Card(ACE, DIAMONDS)));
+    for (int i = 0; i < CardSet::NUM_CARDS; ++i) {
+        ASSERT_EQUAL(i, CardSet::index_of(CardSet::card_at(i)));
+    }
+}
+//insert and erase
+TEST(test_insert_erase) {
+    CardSet set;
+    ASSERT_TRUE(set.empty());
+    set.insert(Card(JACK, HEARTS));
+    set.insert(Card(NINE, CLUBS));
+    set.insert(Card(JACK, HEARTS));
+    ASSERT_EQUAL(2, set.size());
+    ASSERT_TRUE(set.contains(Card(JACK, HEARTS)));
+    ASSERT_FALSE(set.contains(Card(JACK, DIAMONDS)));
+    set.erase(Card(JACK, HEARTS));
+    ASSERT_EQUAL(1, set.size());
+    ASSERT_FALSE(set.contains(Card(JACK, HEARTS)));
+}
+//suit counts
+TEST(test_count_left_bower) {
+    CardSet set;
+    set.insert(Card(JACK, DIAMONDS)); //left bower when hearts is trump
+    set.insert(Card(NINE, DIAMONDS));
+    set.insert(Card(TEN, HEARTS));
+    ASSERT_EQUAL(2, set.count(HEARTS, HEARTS));
+    ASSERT_EQUAL(1, set.count(DIAMONDS, HEARTS));
+    ASSERT_EQUAL(2, set.count(DIAMONDS, SPADES));
+    ASSERT_EQUAL(1, (set & CardSet::face_or_ace()).count(HEARTS, HEARTS));
+}
+//ordering matches operator<
+TEST(test_iteration_sorted) {
+    CardSet set;
+    set.insert(Card(ACE, SPADES));
+    set.insert(Card(NINE, DIAMONDS));
+    set.insert(Card(NINE, HEARTS));
+    set.insert(Card(KING, CLUBS));
+    Card expected[] = { Card(NINE, HEARTS), Card(NINE, DIAMONDS),
+                        Card(KING, CLUBS), Card(ACE, SPADES) };
+    int i = 0;
+    for (const Card &card : set) {
+        ASSERT_EQUAL(expected[i], card);
+        ASSERT_EQUAL(expected[i], set.nth(i));
+        ++i;
+    }
+    ASSERT_EQUAL(4, i);
+    ASSERT_EQUAL(Card(NINE, HEARTS), set.lowest());
+    ASSERT_EQUAL(Card(ACE, SPADES), set.highest());
+}
+//trump order
+TEST(test_trump_order) {
+    CardSet set;
+    set.insert(Card(JACK, CLUBS));   //left bower
+    set.insert(Card(ACE, SPADES));
+    set.insert(Card(NINE, SPADES));
+    set.insert(Card(KING, HEARTS));
+    ASSERT_EQUAL(Card(JACK, CLUBS), set.highest(SPADES));
+    ASSERT_EQUAL(Card(KING, HEARTS), set.lowest(SPADES));
+    set.erase(Card(KING, HEARTS));
+    ASSERT_EQUAL(Card(NINE, SPADES), set.lowest(SPADES));
+    set.insert(Card(JACK, SPADES));  //right bower
+    ASSERT_EQUAL(Card(JACK, SPADES), set.highest(SPADES));
+    ASSERT_EQUAL(Card(ACE, SPADES), set.highest(HEARTS));
+}
+//set operations
+TEST(test_set_operations) {
+    CardSet trump = CardSet::trump_cards(DIAMONDS);
+    ASSERT_EQUAL(7, trump.size());
+    ASSERT_TRUE(trump.contains(Card(JACK, HEARTS)));
+    CardSet hearts = CardSet::of_suit(HEARTS, DIAMONDS);
+    ASSERT_EQUAL(5, hearts.size());
+    ASSERT_TRUE((trump & hearts).empty());
+    ASSERT_TRUE((trump | hearts) == (CardSet::of_suit(HEARTS) |
+                                     CardSet::of_suit(DIAMONDS)));
+    ASSERT_EQUAL(6, (trump - CardSet::of_suit(HEARTS)).size());
+}
+
+TEST_MAIN()
@@ -0,0 +1,411 @@
+#include "DoubleDummy.hpp"
+#include "TrumpOrder.hpp"
+#include <algorithm>
+#include <cassert>
+
+using namespace std;
+
+namespace {
+
+const int NUM_CARDS = PackedCard::NUM_CARDS;
+
+const int MAX_HAND_SIZE = 5;
+
+// Number of transposition table entries, a power of two
+const size_t TABLE_SIZE = 1 << 14;
+
+// The search works on cards renumbered for the trump suit: each suit takes
+// a run of positions from its weakest card to its strongest, with trump on
+// top.  Within a suit a higher position is then a stronger card, so trick
+// winners and interchangeable cards are found with bit operations.
+struct Layout {
+  uint8_t position[NUM_CARDS];   // position of each card index
+  uint8_t card[NUM_CARDS];       // card index at each position
+  uint32_t suit_mask[4];         // positions of each suit
+  uint32_t same_suit[NUM_CARDS]; // positions of the suit of each position
+  uint32_t below[NUM_CARDS];     // positions of the same suit below each
+};
+
+constexpr array<Layout, 4> make_layouts() {
+  array<Layout, 4> layouts = {};
+  for (int t = SPADES; t <= DIAMONDS; ++t) {
+    Suit trump = static_cast<Suit>(t);
+    Layout &layout = layouts[t];
+    // Sort key: suit with trump last, then strength
+    int keys[NUM_CARDS] = {};
+    for (int i = 0; i < NUM_CARDS; ++i) {
+      PackedCard card(i);
+      Suit suit = card.get_suit(trump);
+      keys[i] = (suit == trump ? 4 : suit) * 100 + trump_strength(card, trump);
+      layout.card[i] = i;
+    }
+    for (int i = 1; i < NUM_CARDS; ++i) {
+      for (int j = i; j > 0 && keys[layout.card[j]] < keys[layout.card[j - 1]];
+           --j) {
+        uint8_t swapped = layout.card[j];
+        layout.card[j] = layout.card[j - 1];
+        layout.card[j - 1] = swapped;
+      }
+    }
+    for (int p = 0; p < NUM_CARDS; ++p) {
+      PackedCard card(layout.card[p]);
+      layout.position[card.index()] = p;
+      layout.suit_mask[card.get_suit(trump)] |= 1u << p;
+    }
+    for (int p = 0; p < NUM_CARDS; ++p) {
+      Suit suit = PackedCard(layout.card[p]).get_suit(trump);
+      layout.same_suit[p] = layout.suit_mask[suit];
+      layout.below[p] = layout.suit_mask[suit] & ((1u << p) - 1);
+    }
+  }
+  return layouts;
+}
+
+constexpr array<Layout, 4> LAYOUTS = make_layouts();
+
+// EFFECTS: Returns the highest set bit of bits, which must not be zero
+int highest_bit(uint32_t bits) {
+  return 31 - __builtin_clz(bits);
+}
+
+// EFFECTS: Returns the cards of hand that may be played to a trick led
+//          with a card of led_suit
+uint32_t legal_bits(uint32_t hand, Suit led_suit, Suit trump) {
+  uint32_t following = hand & CardSet::of_suit(led_suit, trump).bits();
+  return following ? following : hand;
+}
+
+// EFFECTS: Returns the offset from the leader of the winner of a full trick
+int trick_winner(const PackedCard *trick, Suit trump) {
+  Suit led_suit = trick[0].get_suit(trump);
+  int winner = 0;
+  int highest = trick_strength(trick[0], led_suit, trump);
+  for (int i = 1; i < 4; ++i) {
+    int strength = trick_strength(trick[i], led_suit, trump);
+    if (strength > highest) {
+      highest = strength;
+      winner = i;
+    }
+  }
+  return winner;
+}
+
+uint64_t mix(uint64_t z) {
+  z = (z ^ (z >> 30)) * 0xBF58476D1CE4E5B9ull;
+  z = (z ^ (z >> 27)) * 0x94D049BB133111EBull;
+  return z ^ (z >> 31);
+}
+
+} // namespace
+
+// PlayState implementation
+PlayState::PlayState(const array<CardSet, 4> &hands_in, Suit trump_in,
+                     int leader_in)
+  : hands(hands_in), trump(trump_in), leader(leader_in), num_played(0),
+    trick(), tricks{0, 0} {}
+
+int PlayState::to_move() const {
+  return (leader + num_played) % 4;
+}
+
+CardSet PlayState::legal_cards() const {
+  uint32_t hand = hands[to_move()].bits();
+  if (num_played == 0) {
+    return hands[to_move()];
+  }
+  return CardSet(legal_bits(hand, trick[0].get_suit(trump), trump));
+}
+
+void PlayState::play(PackedCard card) {
+  int seat = to_move();
+  assert(legal_cards().contains(card.to_card()));
+  hands[seat] = CardSet(hands[seat].bits() & ~(1u << card.index()));
+  trick[num_played++] = card;
+  if (num_played == 4) {
+    leader = (leader + trick_winner(trick.data(), trump)) % 4;
+    tricks[leader % 2]++;
+    num_played = 0;
+  }
+}
+
+// DoubleDummy implementation
+DoubleDummy::DoubleDummy()
+  : table(TABLE_SIZE, Entry{~0ull, ~0ull, 0, 0}), nodes(0), hands(),
+    trump(SPADES), leader(0), num_played(0), trick() {}
+
+int DoubleDummy::solve(const array<CardSet, 4> &hands_in, Suit trump_in,
+                       int leader_in) {
+  return solve(PlayState(hands_in, trump_in, leader_in));
+}
+
+int DoubleDummy::solve(const PlayState &state) {
+  load(state);
+  return solve_position(3);
+}
+
+void DoubleDummy::solve_moves(const PlayState &state,
+                              int values[PackedCard::NUM_CARDS]) {
+  load(state);
+  const Layout &layout = LAYOUTS[trump];
+  int seat = (leader + num_played) % 4;
+  uint32_t moves = hands[seat];
+  uint32_t live = hands[0] | hands[1] | hands[2] | hands[3];
+  if (num_played > 0) {
+    uint32_t led_suit = layout.same_suit[trick[0]];
+    moves = moves & led_suit ? moves & led_suit : moves;
+    for (int i = 0; i < num_played; ++i) {
+      live |= 1u << trick[i];
+    }
+  }
+  // Highest card first, so a card interchangeable with the one just above
+  // it can copy that card's value instead of being solved again
+  int previous = -1;
+  int value = 3;
+  for (uint32_t remaining = moves; remaining; remaining &= ~(1u << previous)) {
+    int position = highest_bit(remaining);
+    bool same_as_previous = previous >= 0 &&
+      (layout.below[previous] & ~layout.below[position] & live) ==
+      1u << position;
+    if (!same_as_previous) {
+      hands[seat] &= ~(1u << position);
+      trick[num_played++] = position;
+      // Most cards are worth about what the card before was
+      value = solve_position(value);
+      --num_played;
+      hands[seat] |= 1u << position;
+    }
+    values[layout.card[position]] = value;
+    previous = position;
+  }
+}
+
+long long DoubleDummy::get_nodes() const {
+  return nodes;
+}
+
+void DoubleDummy::load(const PlayState &state) {
+  trump = state.trump;
+  const Layout &layout = LAYOUTS[trump];
+  for (int seat = 0; seat < 4; ++seat) {
+    hands[seat] = 0;
+    for (uint32_t bits = state.hands[seat].bits(); bits; bits &= bits - 1) {
+      hands[seat] |= 1u << layout.position[__builtin_ctz(bits)];
+    }
+  }
+  leader = state.leader;
+  num_played = state.num_played;
+  for (int i = 0; i < num_played; ++i) {
+    trick[i] = layout.position[state.trick[i].index()];
+  }
+}
+
+int DoubleDummy::solve_position(int guess) {
+  // The leader has already played to a trick that has started
+  int high = __builtin_popcount(hands[leader]) + (num_played > 0 ? 1 : 0);
+  int low = 0;
+  // Narrow searches are much faster than one wide one, so find the value by
+  // asking "do players 0 and 2 take at least k tricks?" for a few k.  The
+  // answer is a bound on the value, which often settles it at once.
+  int k = min(max(guess, 1), high);
+  while (low < high) {
+    int value = num_played == 4 ? finish_trick(k - 1, k) : search(k - 1, k);
+    if (value >= k) {
+      low = value;
+    } else {
+      high = value;
+    }
+    k = (low + high + 1) / 2;
+  }
+  return low;
+}
+
+DoubleDummy::Entry & DoubleDummy::entry(uint64_t key_high, uint64_t key_low) {
+  size_t slot = mix(key_high ^ mix(key_low)) & (TABLE_SIZE - 1);
+  return table[slot];
+}
+
+int DoubleDummy::search(int alpha, int beta) {
+  ++nodes;
+  Entry *stored = nullptr;
+  uint64_t key_high = 0;
+  uint64_t key_low = 0;
+  int lower = 0;
+  int upper = 0;
+  if (num_played == 0) {
+    int remaining = __builtin_popcount(hands[leader]);
+    if (remaining == 0 || beta <= 0) {
+      return 0;
+    }
+    if (alpha >= remaining) {
+      return remaining;
+    }
+    if (remaining == 1) {
+      // Everyone plays their last card
+      for (int i = 0; i < 4; ++i) {
+        trick[i] = __builtin_ctz(hands[(leader + i) % 4]);
+      }
+      return (leader + winning_offset(4)) % 2 == 0 ? 1 : 0;
+    }
+    key_high = hands[0] | static_cast<uint64_t>(hands[1]) << 24 |
+               static_cast<uint64_t>(leader) << 48 |
+               static_cast<uint64_t>(trump) << 50;
+    key_low = hands[2] | static_cast<uint64_t>(hands[3]) << 24;
+    stored = &entry(key_high, key_low);
+    if (stored->key_high == key_high && stored->key_low == key_low) {
+      lower = stored->lower;
+      upper = stored->upper;
+      if (lower >= beta || lower == upper) {
+        return lower;
+      }
+      if (upper <= alpha) {
+        return upper;
+      }
+      alpha = max(alpha, lower);
+      beta = min(beta, upper);
+    } else {
+      upper = remaining;
+    }
+  }
+  int alpha_start = alpha;
+  int beta_start = beta;
+
+  const Layout &layout = LAYOUTS[trump];
+  int seat = (leader + num_played) % 4;
+  bool maximizing = seat % 2 == 0;
+  uint32_t moves = hands[seat];
+  // Cards still in play, to tell which moves are interchangeable
+  uint32_t live = hands[0] | hands[1] | hands[2] | hands[3];
+  if (num_played > 0) {
+    uint32_t led_suit = layout.same_suit[trick[0]];
+    moves = moves & led_suit ? moves & led_suit : moves;
+    for (int i = 0; i < num_played; ++i) {
+      live |= 1u << trick[i];
+    }
+  }
+
+  int order[MAX_HAND_SIZE];
+  int num_moves = order_moves(moves, live, order);
+
+  int best = maximizing ? -1 : 6;
+  for (int n = 0; n < num_moves && alpha < beta; ++n) {
+    int position = order[n];
+    uint32_t bit = 1u << position;
+    hands[seat] &= ~bit;
+    trick[num_played++] = position;
+    int value = num_played == 4 ? finish_trick(alpha, beta)
+                                : search(alpha, beta);
+    --num_played;
+    hands[seat] |= bit;
+
+    if (maximizing) {
+      best = max(best, value);
+      alpha = max(alpha, value);
+    } else {
+      best = min(best, value);
+      beta = min(beta, value);
+    }
+  }
+
+  if (stored) {
+    // The entry may have been replaced by a deeper position meanwhile
+    if (best <= alpha_start) {
+      upper = best;
+    } else if (best >= beta_start) {
+      lower = best;
+    } else {
+      lower = best;
+      upper = best;
+    }
+    *stored = Entry{key_high, key_low, static_cast<int8_t>(lower),
+                    static_cast<int8_t>(upper)};
+  }
+  return best;
+}
+
+int DoubleDummy::order_moves(uint32_t moves, uint32_t live,
+                             int *order) const {
+  const Layout &layout = LAYOUTS[trump];
+  // Only one card of each run of interchangeable cards is searched: a card
+  // just below another of the same suit, with no card still in play
+  // between them, does exactly what that card does
+  int candidates[MAX_HAND_SIZE];
+  int num_candidates = 0;
+  int previous = -1;
+  for (uint32_t remaining = moves; remaining; remaining &= ~(1u << previous)) {
+    int position = highest_bit(remaining);
+    bool same_as_previous = previous >= 0 &&
+      (layout.below[previous] & ~layout.below[position] & live) ==
+      1u << position;
+    if (!same_as_previous) {
+      candidates[num_candidates++] = position;
+    }
+    previous = position;
+  }
+  // Lead high.  When following, try the cheapest card that takes the trick
+  // first, unless partner is already winning it, then the rest lowest first.
+  if (num_played == 0) {
+    for (int n = 0; n < num_candidates; ++n) {
+      order[n] = candidates[n];
+    }
+  } else {
+    int winner = winning_offset(num_played);
+    int winning = trick[winner];
+    bool partner_winning = winner + 2 == num_played;
+    int first = num_candidates - 1;
+    for (int i = num_candidates - 1; i >= 0 && !partner_winning; --i) {
+      if (beats(candidates[i], winning)) {
+        first = i;
+        break;
+      }
+    }
+    order[0] = candidates[first];
+    int n = 1;
+    for (int i = num_candidates - 1; i >= 0; --i) {
+      if (i != first) {
+        order[n++] = candidates[i];
+      }
+    }
+  }
+  return num_candidates;
+}
+
+bool DoubleDummy::beats(int position, int other) const {
+  const Layout &layout = LAYOUTS[trump];
+  if (layout.same_suit[other] & 1u << position) {
+    return position > other;
+  }
+  return (layout.suit_mask[trump] & 1u << position) != 0;
+}
+
+int DoubleDummy::winning_offset(int count) const {
+  // Trump beats everything, otherwise the strongest card of the led suit
+  const Layout &layout = LAYOUTS[trump];
+  uint32_t played = 0;
+  for (int i = 0; i < count; ++i) {
+    played |= 1u << trick[i];
+  }
+  uint32_t trumps = played & layout.suit_mask[trump];
+  uint32_t led = played & layout.same_suit[trick[0]];
+  int winning_position = highest_bit(trumps ? trumps : led);
+  int winner = 0;
+  while (trick[winner] != winning_position) {
+    ++winner;
+  }
+  return winner;
+}
+
+int DoubleDummy::finish_trick(int alpha, int beta) {
+  // The next trick is played into the same array
+  uint8_t saved_trick[4] = { trick[0], trick[1], trick[2], trick[3] };
+  int saved_leader = leader;
+  leader = (leader + winning_offset(4)) % 4;
+  int won = leader % 2 == 0 ? 1 : 0;
+  num_played = 0;
+  int value = won + search(alpha - won, beta - won);
+  num_played = 4;
+  leader = saved_leader;
+  for (int i = 0; i < 4; ++i) {
+    trick[i] = saved_trick[i];
+  }
+  return value;
+}
@@ -0,0 +1,140 @@
+#ifndef DOUBLEDUMMY_HPP
+#define DOUBLEDUMMY_HPP
+/* DoubleDummy.hpp
+ *
+ * Exact solver for the play of a euchre hand when every player can see
+ * every hand ("double dummy").  Finds how many tricks each team takes when
+ * both teams play perfectly, by alpha-beta search over the same trick
+ * sequence that Game::play_hand plays out: the leader plays any card, the
+ * others must follow the led suit if they can, and the highest trick
+ * strength wins and leads next.
+ *
+ * Positions at the start of a trick are stored in a transposition table,
+ * which is kept between calls to solve(), so one solver can be reused for
+ * many deals.  Cards that are next to each other in the same suit once
+ * played cards are removed are interchangeable, so only one of them is
+ * searched.
+ */
+
+#include "Card.hpp"
+#include "CardSet.hpp"
+#include "PackedCard.hpp"
+#include <array>
+#include <cstdint>
+#include <vector>
+
+// A position in the play of a hand
+struct PlayState {
+  std::array<CardSet, 4> hands; // cards each seat still holds
+  Suit trump;
+  int leader;     // seat that led the current trick, or leads the next one
+  int num_played; // cards already played to the current trick, 0..3
+  std::array<PackedCard, 4> trick; // trick[i] was played by leader + i
+  int tricks[2];  // tricks taken so far by each team
+
+  //REQUIRES hands are disjoint and hold the cards of the rest of the hand
+  //EFFECTS Initializes the position at the start of a trick led by leader
+  PlayState(const std::array<CardSet, 4> &hands_in, Suit trump_in,
+            int leader_in);
+
+  //EFFECTS Returns the seat whose turn it is
+  int to_move() const;
+
+  //EFFECTS Returns the cards the player to move may play: cards of the
+  //  led suit if there are any, otherwise the whole hand
+  CardSet legal_cards() const;
+
+  //REQUIRES card is in legal_cards()
+  //MODIFIES this
+  //EFFECTS Plays card for the player to move.  If it completes the trick,
+  //  the winner's team gets the trick and the winner leads next.
+  void play(PackedCard card);
+};
+
+class DoubleDummy {
+public:
+  //EFFECTS Initializes a solver with an empty transposition table
+  DoubleDummy();
+
+  //REQUIRES hands are disjoint and each holds the same number of cards,
+  //  at most 5
+  //EFFECTS Returns the number of tricks players 0 and 2 take with perfect
+  //  play by both teams, when leader leads the first trick.  Players 1 and
+  //  3 take the rest.
+  int solve(const std::array<CardSet, 4> &hands, Suit trump, int leader);
+
+  //REQUIRES every seat still holds its cards for the rest of the hand
+  //EFFECTS Returns the number of the remaining tricks, including the
+  //  current one, that players 0 and 2 take with perfect play
+  int solve(const PlayState &state);
+
+  //REQUIRES every seat still holds its cards for the rest of the hand
+  //MODIFIES values
+  //EFFECTS For every card the player to move may play, sets values[i],
+  //  where i is the card's index, to the number of the remaining tricks
+  //  players 0 and 2 take with perfect play after that card is played.
+  //  Other entries of values are not changed.
+  void solve_moves(const PlayState &state, int values[PackedCard::NUM_CARDS]);
+
+  //EFFECTS Returns the number of positions searched so far
+  long long get_nodes() const;
+
+private:
+  // Bounds on the value of a position at the start of a trick
+  struct Entry {
+    uint64_t key_high;
+    uint64_t key_low;
+    int8_t lower;
+    int8_t upper;
+  };
+
+  std::vector<Entry> table;
+  long long nodes;
+
+  // The position being searched.  Cards are numbered by their position in
+  // the order of the trump suit (see DoubleDummy.cpp), not by Pack index.
+  uint32_t hands[4];
+  Suit trump;
+  int leader;
+  int num_played;
+  uint8_t trick[4];
+
+  //MODIFIES this
+  //EFFECTS Makes state the position being searched
+  void load(const PlayState &state);
+
+  //EFFECTS Returns the exact number of the remaining tricks, including the
+  //  current one, that players 0 and 2 take from the position in the
+  //  members.  The current trick may be full.  The search starts by
+  //  testing guess, so a close guess makes it faster.
+  int solve_position(int guess);
+
+  //EFFECTS Returns the number of the remaining tricks that players 0 and 2
+  //  take, from the position in the members.  Fail-soft: if the value is
+  //  outside (alpha, beta) the result is only a bound on it.
+  int search(int alpha, int beta);
+
+  //EFFECTS Returns the value of the search with the current trick
+  //  complete, adding the trick to its winner
+  int finish_trick(int alpha, int beta);
+
+  //MODIFIES order
+  //EFFECTS Writes the cards of moves worth searching to order, best guess
+  //  first, and returns how many there are.  live holds every card still in
+  //  play, including the current trick.
+  int order_moves(uint32_t moves, uint32_t live, int *order) const;
+
+  //REQUIRES 1 <= count <= num_played, or count is 4 for a full trick
+  //EFFECTS Returns the offset from the leader of the card winning the
+  //  first count cards of the trick
+  int winning_offset(int count) const;
+
+  //EFFECTS Returns true if the card at position beats the card at other
+  //  when other is winning the trick
+  bool beats(int position, int other) const;
+
+  //EFFECTS Returns the transposition table entry for the position
+  Entry & entry(uint64_t key_high, uint64_t key_low);
+};
+
+#endif // DOUBLEDUMMY_HPP
@@ -0,0 +1,134 @@
+#include "DoubleDummy.hpp"
+#include "Rng.hpp"
+#include "unit_test_framework.hpp"
+#include <array>
+#include <iostream>
+
+using namespace std;
+
+//deals cards_each cards to each seat from a random order of the pack
+array<CardSet, 4> random_deal(CounterRng &rng, int cards_each) {
+    int order[PackedCard::NUM_CARDS];
+    for (int i = 0; i < PackedCard::NUM_CARDS; ++i) {
+        order[i] = i;
+    }
+    for (int i = PackedCard::NUM_CARDS - 1; i > 0; --i) {
+        swap(order[i], order[rng.below(i + 1)]);
+    }
+    array<CardSet, 4> hands;
+    for (int i = 0; i < 4 * cards_each; ++i) {
+        hands[i % 4].insert(PackedCard(order[i]).to_card());
+    }
+    return hands;
+}
+
+//plain minimax over every legal card, no pruning
+int brute_force(const PlayState &state) {
+    if (state.hands[state.to_move()].empty()) {
+        return 0;
+    }
+    bool maximizing = state.to_move() % 2 == 0;
+    int best = maximizing ? -1 : 6;
+    for (Card card : state.legal_cards()) {
+        PlayState next = state;
+        next.play(PackedCard(card));
+        int value = next.tricks[0] - state.tricks[0] + brute_force(next);
+        best = maximizing ? max(best, value) : min(best, value);
+    }
+    return best;
+}
+
+TEST(test_solver_matches_brute_force) {
+    CounterRng rng(12, 0);
+    DoubleDummy solver;
+    for (int deal = 0; deal < 300; ++deal) {
+        int cards_each = 1 + deal % 4;
+        array<CardSet, 4> hands = random_deal(rng, cards_each);
+        Suit trump = static_cast<Suit>(rng.below(4));
+        int leader = rng.below(4);
+        PlayState state(hands, trump, leader);
+        ASSERT_EQUAL(brute_force(state), solver.solve(hands, trump, leader));
+    }
+}
+
+//positions in the middle of a trick, as a player deciding a card sees them
+TEST(test_solver_mid_trick) {
+    CounterRng rng(13, 0);
+    DoubleDummy solver;
+    for (int deal = 0; deal < 200; ++deal) {
+        PlayState state(random_deal(rng, 4), static_cast<Suit>(deal % 4),
+                        deal % 4);
+        int plays = 1 + rng.below(6);
+        for (int i = 0; i < plays; ++i) {
+            CardSet legal = state.legal_cards();
+            state.play(PackedCard(legal.nth(rng.below(legal.size()))));
+        }
+        ASSERT_EQUAL(brute_force(state), solver.solve(state));
+    }
+}
+
+//every legal card gets the value of the position after playing it
+TEST(test_solve_moves) {
+    CounterRng rng(15, 0);
+    DoubleDummy solver;
+    for (int deal = 0; deal < 200; ++deal) {
+        PlayState state(random_deal(rng, 1 + deal % 5),
+                        static_cast<Suit>(deal % 4), rng.below(4));
+        int plays = rng.below(4);
+        for (int i = 0; i < plays && !state.hands[state.to_move()].empty();
+             ++i) {
+            CardSet legal = state.legal_cards();
+            state.play(PackedCard(legal.nth(rng.below(legal.size()))));
+        }
+        if (state.hands[state.to_move()].empty()) {
+            continue;
+        }
+        int values[PackedCard::NUM_CARDS] = {};
+        solver.solve_moves(state, values);
+        for (Card card : state.legal_cards()) {
+            PlayState next = state;
+            next.play(PackedCard(card));
+            int expected = next.tricks[0] - state.tricks[0] + brute_force(next);
+            ASSERT_EQUAL(expected, values[CardSet::index_of(card)]);
+        }
+    }
+}
+
+//the same table gives the same answers when deals are solved again
+TEST(test_solver_reuse) {
+    CounterRng rng(14, 0);
+    DoubleDummy solver;
+    int first[100];
+    for (int deal = 0; deal < 100; ++deal) {
+        first[deal] = solver.solve(random_deal(rng, 5), HEARTS, deal % 4);
+    }
+    CounterRng again(14, 0);
+    DoubleDummy fresh;
+    for (int deal = 0; deal < 100; ++deal) {
+        array<CardSet, 4> hands = random_deal(again, 5);
+        ASSERT_EQUAL(first[deal], solver.solve(hands, HEARTS, deal % 4));
+        ASSERT_EQUAL(first[deal], fresh.solve(hands, HEARTS, deal % 4));
+    }
+}
+
+//holding the five highest trumps takes every trick
+TEST(test_solver_all_top_trumps) {
+    array<CardSet, 4> hands;
+    hands[1].insert(Card(JACK, SPADES));
+    hands[1].insert(Card(JACK, CLUBS));
+    hands[1].insert(Card(ACE, SPADES));
+    hands[1].insert(Card(KING, SPADES));
+    hands[1].insert(Card(QUEEN, SPADES));
+    int dealt = 0;
+    for (Card card : CardSet(0xFFFFFF) - hands[1]) {
+        int seat = dealt < 5 ? 0 : dealt < 10 ? 2 : 3;
+        if (dealt++ < 15) {
+            hands[seat].insert(card);
+        }
+    }
+    DoubleDummy solver;
+    ASSERT_EQUAL(0, solver.solve(hands, SPADES, 0));
+    ASSERT_EQUAL(0, solver.solve(hands, SPADES, 2));
+}
+
+TEST_MAIN()
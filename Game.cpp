@@ -0,0 +1,79 @@
+#include <iostream>
+#include "Game.hpp"
+#include <vector>
+#include <cassert>
+
+using namespace std;
+
+// ShuffleCycle implementation
+ShuffleCycle::ShuffleCycle(const Pack &start) {
+  Pack current = start;
+  for (Pack &cycle_pack : packs) {
+    current.shuffle();
+    cycle_pack = current;
+  }
+}
+
+const Pack & ShuffleCycle::get_pack(int hand) const {
+  assert(hand >= 0);
+  return packs[hand % Pack::SHUFFLE_CYCLE_LENGTH];
+}
+
+// GameTotals implementation
+GameTotals::GameTotals()
+  : games(0), wins{0, 0}, hands(0), euchres(0), marches(0) {}
+
+void GameTotals::add(const GameResult &result) {
+  games++;
+  wins[result.winning_team]++;
+  hands += result.hands;
+  euchres += result.euchres;
+  marches += result.marches;
+}
+
+void GameTotals::merge(const GameTotals &other) {
+  games += other.games;
+  wins[0] += other.wins[0];
+  wins[1] += other.wins[1];
+  hands += other.hands;
+  euchres += other.euchres;
+  marches += other.marches;
+}
+
+long long GameTotals::get_games() const {
+  return games;
+}
+
+long long GameTotals::get_wins(int team) const {
+  assert(team == 0 || team == 1);
+  return wins[team];
+}
+
+long long GameTotals::get_euchres() const {
+  return euchres;
+}
+
+long long GameTotals::get_marches() const {
+  return marches;
+}
+
+double GameTotals::get_average_hands() const {
+  if (games == 0) {
+    return 0;
+  }
+  return static_cast<double>(hands) / games;
+}
+
+void GameTotals::print(ostream &os, const vector<Player*> &players) const {
+  os << games << " games played\n";
+  for (int team = 0; team < 2; ++team) {
+    os << players[team]->get_name() << " and " << players[team + 2]->get_name()
+       << " win " << wins[team] << " games\n";
+  }
+  os << euchres << " euchres\n";
+  os << marches << " marches\n";
+  os << get_average_hands() << " hands per game" << endl;
+}
+
+// Game implementation, see the template in Game.hpp
+template class BasicGame<vector<Player*>>;
@@ -0,0 +1,561 @@
+#ifndef GAME_HPP
+#define GAME_HPP
+/* Game.hpp
+ *
+ * Plays games of euchre between four Players and collects the results.
+ *
+ * The game loop is a template over how the four players are held.  Game
+ * holds them as Player pointers, so any strategy can sit at the table,
+ * Human included.  BotGame holds bots by their own, final types (see
+ * Simple.hpp), so each decision is a direct call the compiler can inline
+ * into the trick loop; a table of four Simple players plays the same
+ * games either way, only faster as a BotGame.
+ */
+
+#include "AllocationTracker.hpp"
+#include "Card.hpp"
+#include "GameLog.hpp"
+#include "OutputSink.hpp"
+#include "Pack.hpp"
+#include "PhaseTimer.hpp"
+#include "Player.hpp"
+#include "Rng.hpp"
+#include "TrumpOrder.hpp"
+#include <array>
+#include <cassert>
+#include <cstdint>
+#include <iostream>
+#include <string>
+#include <vector>
+
+// How the pack is shuffled before each hand
+struct ShuffleSetting {
+  enum Mode {
+    NO_SHUFFLE, // deal from the pack as given
+    IN_SHUFFLE, // seven perfect in-shuffles, see Pack::shuffle()
+    RANDOM,     // Fisher-Yates from the random stream (seed, stream)
+  };
+  Mode mode;
+  uint64_t seed;   // RANDOM only: seed of the whole run
+  uint64_t stream; // RANDOM only: which stream of the run, the game index
+};
+
+// The packs an IN_SHUFFLE game deals from, which repeat every
+// Pack::SHUFFLE_CYCLE_LENGTH hands.  Worked out once per starting pack and
+// shared, read-only, by every game that starts from it.
+class ShuffleCycle {
+public:
+  // EFFECTS: Initializes the cycle of packs that repeated shuffles of start
+  //          go through
+  explicit ShuffleCycle(const Pack &start);
+
+  // REQUIRES: hand >= 0
+  // EFFECTS: Returns the pack for hand, start shuffled hand + 1 times
+  const Pack & get_pack(int hand) const;
+
+private:
+  std::array<Pack, Pack::SHUFFLE_CYCLE_LENGTH> packs;
+};
+
+// Everything a game starts from, apart from its players
+struct GameSetup {
+  Pack pack;              // the order of the pack before the first hand
+  ShuffleSetting shuffle; // how the pack is shuffled before every hand
+  int points_to_win;
+  // With IN_SHUFFLE, the ShuffleCycle of pack to copy each hand's pack from,
+  // or nullptr to shuffle each hand's pack from the last.  Not owned.
+  const ShuffleCycle *cycle = nullptr;
+};
+
+// Outcome of one game
+struct GameResult {
+  int winning_team; // 0 for players 0 and 2, 1 for players 1 and 3
+  int hands;        // number of hands played
+  int euchres;      // hands won by the team that did not order up
+  int marches;      // hands where the makers took all five tricks
+  int scores[2];    // final score of each team
+};
+
+// Running totals over many games, for batch and tournament summaries
+class GameTotals {
+public:
+  // EFFECTS: Initializes totals with no games
+  GameTotals();
+
+  // EFFECTS: Adds the result of one game to the totals
+  void add(const GameResult &result);
+
+  // EFFECTS: Adds every game counted in other to the totals
+  void merge(const GameTotals &other);
+
+  // EFFECTS: Returns the number of games counted
+  long long get_games() const;
+
+  // REQUIRES: team is 0 or 1
+  // EFFECTS: Returns the number of games won by team
+  long long get_wins(int team) const;
+
+  // EFFECTS: Returns the total number of euchres
+  long long get_euchres() const;
+
+  // EFFECTS: Returns the total number of marches
+  long long get_marches() const;
+
+  // EFFECTS: Returns the average number of hands per game, 0 if no games
+  double get_average_hands() const;
+
+  // REQUIRES: players has four players, in seat order
+  // EFFECTS: Prints a summary of the totals to os
+  void print(std::ostream &os, const std::vector<Player*> &players) const;
+
+private:
+  long long games;
+  long long wins[2];
+  long long hands;
+  long long euchres;
+  long long marches;
+};
+
+// Seats of a table of bots whose strategies are known at compile time.
+// The players of team 0 (seats 0 and 2) are Team0s and those of team 1
+// (seats 1 and 3) are Team1s.
+// NOTE: The seats do not own the players, the caller must keep them alive.
+template <typename Team0, typename Team1 = Team0>
+struct BotSeats {
+  // EFFECTS: Initializes the seats with the given players, in seat order
+  BotSeats(Team0 &seat0, Team1 &seat1, Team0 &seat2, Team1 &seat3)
+    : team0{&seat0, &seat2}, team1{&seat1, &seat3} {}
+
+  Team0 *team0[2];
+  Team1 *team1[2];
+};
+
+// REQUIRES: 0 <= seat < 4
+// EFFECTS: Calls f with the player in seat and returns what it returns
+template <typename F>
+decltype(auto) visit_seat(const std::vector<Player*> &players, int seat,
+                          F &&f) {
+  return f(*players[seat]);
+}
+
+// REQUIRES: 0 <= seat < 4
+// EFFECTS: Calls f with the player in seat and returns what it returns.
+//          f is called with the player's own type.
+template <typename Team0, typename Team1, typename F>
+decltype(auto) visit_seat(const BotSeats<Team0, Team1> &seats, int seat,
+                          F &&f) {
+  if (seat % 2 == 0) {
+    return f(*seats.team0[seat / 2]);
+  }
+  return f(*seats.team1[seat / 2]);
+}
+
+// Seats is std::vector<Player*> or BotSeats, see visit_seat
+template <typename Seats>
+class BasicGame {
+public:
+  // REQUIRES: players has four players, in seat order, with empty hands
+  // EFFECTS: Initializes a game as described by setup that writes its
+  //          transcript to out_in
+  // NOTE: The Game does not own the players or the cycle of setup, the
+  //       caller must keep them alive.
+  BasicGame(const GameSetup &setup, const Seats &players,
+            OutputSink &out_in);
+
+  // EFFECTS: Plays hands until a team reaches the points to win, printing
+  //          the transcript, and returns the outcome
+  GameResult play();
+
+  // EFFECTS: Returns the players in seat order
+  const Seats& get_players() const;
+
+  // MODIFIES: log_in
+  // EFFECTS: Makes play() record every hand in log_in, starting it over.
+  //          Pass nullptr to stop logging.
+  void set_log(GameLog *log_in);
+
+private:
+  Pack pack;
+  Seats players;
+  OutputSink &out;
+  Suit trump;
+  int points_to_win;
+  int dealer;
+  int hand;
+  std::array<int, 2> scores;
+  ShuffleSetting shuffle_setting;
+  CounterRng rng;
+  const ShuffleCycle *shuffle_cycle;
+  int trump_team;
+  GameResult result;
+  GameLog *log;
+  // Bids and plays of the current hand, for the log
+  HandLog hand_log;
+
+  void set_players(const Seats& new_players);
+  void shuffle();
+  void deal();
+  void make_trump();
+  void play_hand();
+  void update_scores(const std::array<int, 2>& tricks_won);
+  void print_scores();
+  void print_winner();
+  void log_hand();
+  // Tell every player what happened, see Player::trump_made and card_played
+  void announce_trump(int maker, int round);
+  void announce_card(int seat, const Card &card);
+
+  // Calls f with the player in seat, see visit_seat
+  template <typename F>
+  decltype(auto) with_player(int seat, F &&f) const {
+    return visit_seat(players, seat, f);
+  }
+
+  const std::string & player_name(int seat) const {
+    return with_player(seat, [](const auto &player) -> const std::string & {
+      return player.get_name();
+    });
+  }
+};
+
+// Any strategies, each called through the Player interface
+typedef BasicGame<std::vector<Player*>> Game;
+
+// Bots of known types, see BotSeats
+template <typename Team0, typename Team1 = Team0>
+using BotGame = BasicGame<BotSeats<Team0, Team1>>;
+
+// Game is compiled once, in Game.cpp
+extern template class BasicGame<std::vector<Player*>>;
+
+
+/////////////// Template implementation ///////////////
+
+namespace game_detail {
+  // Pack positions of the dealer's five cards in the 3-2-3-2 deal, followed
+  // by the upcard
+  const int DEALER_POSITIONS[] = { 8, 9, 17, 18, 19, 20 };
+
+  // Cards dealt to each player in turn, starting left of the dealer
+  const int PACKETS[] = { 3, 2, 3, 2, 2, 3, 2, 3 };
+}
+
+//Creates an instance of game.
+template <typename Seats>
+BasicGame<Seats>::BasicGame(const GameSetup &setup, const Seats& players,
+  OutputSink &out_in)
+    : pack(setup.pack), players(players), out(out_in),
+    points_to_win(setup.points_to_win), dealer(0), hand(0), scores{0, 0},
+    shuffle_setting(setup.shuffle),
+    rng(setup.shuffle.seed, setup.shuffle.stream), shuffle_cycle(setup.cycle),
+    trump_team(0), result(), log(nullptr), hand_log() {}
+
+template <typename Seats>
+GameResult BasicGame<Seats>::play(){
+  ALLOCATION_SCOPE(ALLOC_GAME);
+  if (log) {
+    std::vector<std::string> names;
+    for (int seat = 0; seat < 4; ++seat) {
+      names.push_back(player_name(seat));
+    }
+    log->start(names, points_to_win);
+  }
+
+  //loop until a team wins
+  while(this->scores[0] < this->points_to_win && this->scores[1] < this->points_to_win){
+    out << "Hand " << hand << "\n";
+    out << player_name(dealer) << " deals\n";
+    
+    {
+      PHASE_TIMER(PHASE_SHUFFLE);
+      if(shuffle_setting.mode != ShuffleSetting::NO_SHUFFLE) {
+        shuffle();
+      } else{
+        pack.reset(); 
+      }
+    }
+
+    deal();
+    make_trump();
+    play_hand();
+    if (log) {
+      log_hand();
+    }
+    print_scores();
+    dealer = (dealer + 1) % 4;
+    hand++;
+  }
+  print_winner();
+  result.winning_team = scores[0] >= points_to_win ? 0 : 1;
+  result.hands = hand;
+  result.scores[0] = scores[0];
+  result.scores[1] = scores[1];
+  return result;
+}
+
+//Accesses the private player vector to set the new variables.
+template <typename Seats>
+void BasicGame<Seats>::set_players(const Seats& new_players){
+    players = new_players;
+}
+
+template <typename Seats>
+void BasicGame<Seats>::shuffle(){
+  if (shuffle_setting.mode == ShuffleSetting::RANDOM) {
+    pack.shuffle(rng);
+    return;
+  }
+  if (shuffle_cycle) {
+    pack = shuffle_cycle->get_pack(hand);
+  } else {
+    pack.shuffle();
+  }
+}
+
+//3-2-3-2 order
+template <typename Seats>
+void BasicGame<Seats>::deal() {
+  PHASE_TIMER(PHASE_DEAL);
+  // Two rounds of 3, 2, 3, 2 and 2, 3, 2, 3 cards, starting with the
+  // player to the left of the dealer
+  for (int packet = 0; packet < 8; ++packet) {
+    int current_player = (dealer + 1 + packet) % 4;
+    for (int i = 0; i < game_detail::PACKETS[packet]; ++i) {
+      Card dealt = pack.deal_one();
+      with_player(current_player, [&](auto &player) {
+        ALLOCATION_SCOPE(ALLOC_ADD_CARD);
+        player.add_card(dealt);
+      });
+    }
+  }
+}
+
+template <typename Seats>
+void BasicGame<Seats>::make_trump(){
+  PHASE_TIMER(PHASE_MAKE_TRUMP);
+  Card upcard = pack.deal_one();
+  out << upcard << " turned up\n";
+  for (int seat = 0; seat < 4; ++seat) {
+    with_player(seat, [&](auto &player) {
+      ALLOCATION_SCOPE(ALLOC_NOTIFY);
+      player.start_hand(seat, dealer, upcard);
+    });
+  }
+  
+  bool trump_chosen = false;
+  
+  // Round 1
+  for(int i = 1; i <= 4; ++i) {
+    int current_player = (dealer + i) % 4;
+    bool is_dealer = (current_player == dealer);
+    
+    bool orders_up = with_player(current_player, [&](auto &player) {
+      ALLOCATION_SCOPE(ALLOC_MAKE_TRUMP);
+      PHASE_TIMER(PHASE_DECIDE_MAKE_TRUMP);
+      return player.make_trump(upcard, is_dealer, 1, trump);
+    });
+    if(orders_up) {
+      out << player_name(current_player) << " orders up " << trump << "\n";
+      hand_log.passes = i - 1;
+      trump_team = current_player % 2;
+      announce_trump(current_player, 1);
+      with_player(dealer, [&](auto &player) {
+        ALLOCATION_SCOPE(ALLOC_ADD_AND_DISCARD);
+        PHASE_TIMER(PHASE_DECIDE_ADD_AND_DISCARD);
+        player.add_and_discard(upcard);
+      });
+      trump_chosen = true;
+      out << "\n";  // Extra newline after making trump
+      break;
+    } else {
+      out << player_name(current_player) << " passes\n";
+    }
+  }
+  
+  // Round 2 if needed
+  if(trump_chosen) {
+    return; // Early return to avoid nested block
+  }
+  
+  // Continue with round 2
+  for(int i = 1; i <= 4; ++i) {
+    int current_player = (dealer + i) % 4;
+    bool is_dealer = (current_player == dealer);
+    
+    bool orders_up = with_player(current_player, [&](auto &player) {
+      ALLOCATION_SCOPE(ALLOC_MAKE_TRUMP);
+      PHASE_TIMER(PHASE_DECIDE_MAKE_TRUMP);
+      return player.make_trump(upcard, is_dealer, 2, trump);
+    });
+    if(orders_up) {
+      out << player_name(current_player) << " orders up " << trump << "\n";
+      hand_log.passes = 4 + i - 1;
+      trump_team = current_player % 2;
+      announce_trump(current_player, 2);
+      out << "\n";
+      return; // Exit after trump is chosen
+    }
+    
+    out << player_name(current_player) << " passes\n";
+    
+    // Handle dealer separately
+    if(is_dealer) {
+      trump = Suit_next(upcard.get_suit());
+      out << player_name(dealer) << " must order up " << trump << "\n";
+      hand_log.passes = HandLog::DEALER_FORCED;
+      trump_team = dealer % 2;
+      announce_trump(dealer, 2);
+      out << "\n";
+    }
+  }
+}
+
+template <typename Seats>
+void BasicGame<Seats>::play_hand(){
+  PHASE_TIMER(PHASE_PLAY_HAND);
+  std::array<int, 2> tricks_won = {0, 0};
+  int leader = (dealer + 1) % 4;
+
+  for (int trick = 0; trick < 5; trick++) {
+    // Lead
+    Card led_card = with_player(leader, [&](auto &player) {
+      ALLOCATION_SCOPE(ALLOC_LEAD_CARD);
+      PHASE_TIMER(PHASE_DECIDE_LEAD_CARD);
+      return player.lead_card(trump);
+    });
+    out << led_card << " led by " << player_name(leader) << "\n";
+    hand_log.plays[trick * 4] = PackedCard(led_card);
+    announce_card(leader, led_card);
+    
+    // Play remaining cards, tracking the winner by trick strength
+    Suit led_suit = led_card.get_suit(trump);
+    int highest_strength = trick_strength(led_card, led_suit, trump);
+    int winner = leader;
+    
+    for(int i = 1; i < 4; i++) {
+      int current_player = (leader + i) % 4;
+      Card played = with_player(current_player, [&](auto &player) {
+        ALLOCATION_SCOPE(ALLOC_PLAY_CARD);
+        PHASE_TIMER(PHASE_DECIDE_PLAY_CARD);
+        return player.play_card(led_card, trump);
+      });
+      out << played << " played by " << player_name(current_player) << "\n";
+      hand_log.plays[trick * 4 + i] = PackedCard(played);
+      announce_card(current_player, played);
+      
+      int strength = trick_strength(played, led_suit, trump);
+      if(strength > highest_strength) {
+        highest_strength = strength;
+        winner = current_player;
+      }
+    }
+    
+    out << player_name(winner) << " takes the trick\n";
+    out << "\n";  // Extra newline after each trick
+    
+    tricks_won[winner % 2]++;
+    leader = winner;
+  }
+  update_scores(tricks_won);
+}
+
+template <typename Seats>
+void BasicGame<Seats>::update_scores(const std::array<int, 2>& tricks_won){
+  PHASE_TIMER(PHASE_UPDATE_SCORES);
+  //out << trump_team << endl;
+  if (tricks_won[trump_team] >= 3) {
+    out << player_name(trump_team) << " and " 
+         << player_name(trump_team + 2) << " win the hand\n";
+    if(tricks_won[trump_team] == 5) {
+      scores[trump_team] += 2;
+      result.marches++;
+      out << "march!\n";
+    } else {
+      scores[trump_team] += 1;
+    }
+  } else {
+    out << player_name(1 - trump_team) << " and " 
+         << player_name((1 - trump_team) + 2) << " win the hand\n";
+    scores[1 - trump_team] += 2;
+    result.euchres++;
+    out << "euchred!\n";
+  }
+}
+
+template <typename Seats>
+void BasicGame<Seats>::print_scores(){
+  out << player_name(0) << " and " << player_name(2) 
+  << " have " << scores[0] << " points\n";
+  out << player_name(1) << " and " << player_name(3) 
+  << " have " << scores[1] << " points\n";
+  out << "\n";  // Extra newline after scores
+}
+
+template <typename Seats>
+void BasicGame<Seats>::print_winner(){
+  //out << endl;  // Extra newline before winner
+  if (scores[0] >= this->points_to_win) {
+    out << player_name(0) << " and " << player_name(2)
+        << " win!\n";
+  } else {
+    out << player_name(1) << " and " << player_name(3)
+        << " win!\n";
+  }
+}
+
+template <typename Seats>
+void BasicGame<Seats>::announce_trump(int maker, int round){
+  for (int seat = 0; seat < 4; ++seat) {
+    with_player(seat, [&](auto &player) {
+      ALLOCATION_SCOPE(ALLOC_NOTIFY);
+      player.trump_made(maker, trump, round);
+    });
+  }
+}
+
+template <typename Seats>
+void BasicGame<Seats>::announce_card(int seat, const Card &card){
+  for (int player_seat = 0; player_seat < 4; ++player_seat) {
+    with_player(player_seat, [&](auto &player) {
+      ALLOCATION_SCOPE(ALLOC_NOTIFY);
+      player.card_played(seat, card);
+    });
+  }
+}
+
+template <typename Seats>
+void BasicGame<Seats>::log_hand(){
+  for (int i = 0; i < HandLog::PACK_CARDS; ++i) {
+    hand_log.pack[i] = pack.card_at(i);
+  }
+  hand_log.dealer = dealer;
+  hand_log.trump = trump;
+  hand_log.discard = -1;
+  if (hand_log.passes < 4) {
+    // The dealer's discard is the one card of the dealer's hand and the
+    // upcard that was never played
+    for (int position : game_detail::DEALER_POSITIONS) {
+      PackedCard card = hand_log.pack[position];
+      bool played = false;
+      for (PackedCard play : hand_log.plays) {
+        played = played || play == card;
+      }
+      if (!played) {
+        hand_log.discard = card.index();
+      }
+    }
+  }
+  log->add_hand(hand_log);
+}
+
+template <typename Seats>
+const Seats& BasicGame<Seats>::get_players() const {
+  return players;
+}
+
+template <typename Seats>
+void BasicGame<Seats>::set_log(GameLog *log_in) {
+  log = log_in;
+}
+
+#endif // GAME_HPP
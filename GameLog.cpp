@@ -0,0 +1,263 @@
+#include "GameLog.hpp"
+#include "CardSet.hpp"
+#include "DoubleDummy.hpp"
+#include <cassert>
+
+using namespace std;
+
+namespace {
+
+// First byte of every game, changed whenever the format changes
+const uint8_t FORMAT_VERSION = 1;
+
+const int CARD_BITS = 5;
+const int NO_DISCARD = 31;
+
+// Cards dealt to each player in turn, starting left of the dealer, as in
+// Game::deal
+const int PACKETS[] = { 3, 2, 3, 2, 2, 3, 2, 3 };
+// Pack position of the upcard, the first card after the deal
+const int UPCARD_POSITION = 20;
+
+// Appends fields of a few bits each to a hand record, lowest bits first
+class BitWriter {
+public:
+  explicit BitWriter(uint8_t *out_in) : out(out_in), bits(0), used(0) {}
+
+  void put(unsigned value, int width) {
+    bits |= static_cast<uint64_t>(value) << used;
+    used += width;
+    while (used >= 8) {
+      *out++ = static_cast<uint8_t>(bits);
+      bits >>= 8;
+      used -= 8;
+    }
+  }
+
+  // EFFECTS: Writes out the last partial byte
+  void finish() {
+    if (used > 0) {
+      *out++ = static_cast<uint8_t>(bits);
+      bits = 0;
+      used = 0;
+    }
+  }
+
+private:
+  uint8_t *out;
+  uint64_t bits;
+  int used;
+};
+
+// Reads back the fields written by BitWriter
+class BitReader {
+public:
+  explicit BitReader(const uint8_t *in_in) : in(in_in), bits(0), available(0) {}
+
+  unsigned get(int width) {
+    while (available < width) {
+      bits |= static_cast<uint64_t>(*in++) << available;
+      available += 8;
+    }
+    unsigned value = static_cast<unsigned>(bits & ((1u << width) - 1));
+    bits >>= width;
+    available -= width;
+    return value;
+  }
+
+private:
+  const uint8_t *in;
+  uint64_t bits;
+  int available;
+};
+
+void write_uint16(ostream &os, int value) {
+  os.put(static_cast<char>(value & 0xFF));
+  os.put(static_cast<char>(value >> 8));
+}
+
+bool read_uint16(istream &is, int &value) {
+  unsigned char bytes[2];
+  if (!is.read(reinterpret_cast<char *>(bytes), 2)) {
+    return false;
+  }
+  value = bytes[0] | (bytes[1] << 8);
+  return true;
+}
+
+// REQUIRES: the pack of hand holds every card once and its discard is -1
+//           or a card
+// EFFECTS: Returns true if the hand could have been played: the dealer
+//          discarded one of the dealer's cards or the upcard, and every
+//          card was played by the seat holding it, following the led suit
+//          when that seat could
+bool legal_plays(const HandLog &hand) {
+  array<CardSet, 4> hands;
+  int position = 0;
+  for (int packet = 0; packet < 8; ++packet) {
+    int seat = (hand.dealer + 1 + packet) % 4;
+    for (int i = 0; i < PACKETS[packet]; ++i) {
+      hands[seat].insert(hand.pack[position++].to_card());
+    }
+  }
+  if (hand.discard >= 0) {
+    CardSet &dealer_hand = hands[hand.dealer];
+    Card discard = PackedCard(hand.discard).to_card();
+    dealer_hand.insert(hand.pack[UPCARD_POSITION].to_card());
+    if (!dealer_hand.contains(discard)) {
+      return false;
+    }
+    dealer_hand.erase(discard);
+  }
+  PlayState state(hands, hand.trump, (hand.dealer + 1) % 4);
+  for (PackedCard card : hand.plays) {
+    if (!state.legal_cards().contains(card.to_card())) {
+      return false;
+    }
+    state.play(card);
+  }
+  return true;
+}
+
+// EFFECTS: Returns true if every field of hand is in the range described
+//          in HandLog, the pack holds every card once, and the plays are
+//          legal as in legal_plays
+bool valid_hand(const HandLog &hand) {
+  uint32_t seen = 0;
+  for (PackedCard card : hand.pack) {
+    if (card.index() >= HandLog::PACK_CARDS || seen >> card.index() & 1) {
+      return false;
+    }
+    seen |= 1u << card.index();
+  }
+  if (hand.passes > HandLog::DEALER_FORCED ||
+      (hand.discard == -1) != (hand.passes >= 4) ||
+      hand.discard >= HandLog::PACK_CARDS) {
+    return false;
+  }
+  for (PackedCard card : hand.plays) {
+    if (card.index() >= HandLog::PACK_CARDS) {
+      return false;
+    }
+  }
+  return legal_plays(hand);
+}
+
+} // namespace
+
+GameLog::GameLog() : points_to_win(0) {}
+
+void GameLog::start(const vector<string> &names_in, int points) {
+  assert(names_in.size() == 4);
+  for (int seat = 0; seat < 4; ++seat) {
+    assert(names_in[seat].size() <= 255);
+    names[seat] = names_in[seat];
+  }
+  assert(points > 0 && points <= 0xFFFF);
+  points_to_win = points;
+  hands.clear();
+}
+
+void GameLog::add_hand(const HandLog &hand) {
+  assert(num_hands() < 0xFFFF);
+  assert(0 <= hand.passes && hand.passes <= HandLog::DEALER_FORCED);
+  assert((hand.discard == -1) == (hand.passes >= 4));
+  size_t offset = hands.size();
+  hands.resize(offset + HAND_RECORD_BYTES);
+  BitWriter writer(&hands[offset]);
+  for (PackedCard card : hand.pack) {
+    writer.put(card.index(), CARD_BITS);
+  }
+  writer.put(hand.dealer, 2);
+  writer.put(hand.passes, 4);
+  writer.put(hand.trump, 2);
+  writer.put(hand.discard < 0 ? NO_DISCARD : hand.discard, CARD_BITS);
+  for (PackedCard card : hand.plays) {
+    writer.put(card.index(), CARD_BITS);
+  }
+  writer.finish();
+}
+
+int GameLog::num_hands() const {
+  return hands.size() / HAND_RECORD_BYTES;
+}
+
+HandLog GameLog::get_hand(int index) const {
+  assert(0 <= index && index < num_hands());
+  HandLog hand;
+  BitReader reader(&hands[index * HAND_RECORD_BYTES]);
+  for (PackedCard &card : hand.pack) {
+    card = PackedCard(reader.get(CARD_BITS));
+  }
+  hand.dealer = reader.get(2);
+  hand.passes = reader.get(4);
+  hand.trump = static_cast<Suit>(reader.get(2));
+  int discard = reader.get(CARD_BITS);
+  hand.discard = discard == NO_DISCARD ? -1 : discard;
+  for (PackedCard &card : hand.plays) {
+    card = PackedCard(reader.get(CARD_BITS));
+  }
+  return hand;
+}
+
+const string & GameLog::get_name(int seat) const {
+  assert(0 <= seat && seat < 4);
+  return names[seat];
+}
+
+int GameLog::get_points_to_win() const {
+  return points_to_win;
+}
+
+size_t GameLog::size_in_bytes() const {
+  // version, points, one length byte per name, hand count
+  size_t size = 1 + 2 + 4 + 2 + hands.size();
+  for (const string &name : names) {
+    size += name.size();
+  }
+  return size;
+}
+
+void GameLog::write(ostream &os) const {
+  os.put(static_cast<char>(FORMAT_VERSION));
+  write_uint16(os, points_to_win);
+  for (const string &name : names) {
+    os.put(static_cast<char>(name.size()));
+    os.write(name.data(), name.size());
+  }
+  write_uint16(os, num_hands());
+  os.write(reinterpret_cast<const char *>(hands.data()), hands.size());
+}
+
+bool GameLog::read(istream &is) {
+  int version = is.get();
+  if (version != FORMAT_VERSION || !read_uint16(is, points_to_win) ||
+      points_to_win == 0) {
+    return false;
+  }
+  for (string &name : names) {
+    int length = is.get();
+    if (length == EOF) {
+      return false;
+    }
+    name.resize(length);
+    if (!is.read(&name[0], length)) {
+      return false;
+    }
+  }
+  int count;
+  if (!read_uint16(is, count)) {
+    return false;
+  }
+  hands.resize(count * HAND_RECORD_BYTES);
+  if (!is.read(reinterpret_cast<char *>(hands.data()), hands.size())) {
+    return false;
+  }
+  // A corrupt log must not reach code that indexes by card
+  for (int index = 0; index < count; ++index) {
+    if (!valid_hand(get_hand(index))) {
+      return false;
+    }
+  }
+  return true;
+}
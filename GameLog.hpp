@@ -0,0 +1,110 @@
+#ifndef GAMELOG_HPP
+#define GAMELOG_HPP
+/* GameLog.hpp
+ *
+ * Compact binary record of a game of euchre.
+ *
+ * A game is a short header (points to win and the four player names)
+ * followed by one fixed-size record per hand.  Every card is its 5-bit
+ * index in the Pack order (see PackedCard), and a hand record holds:
+ *
+ *   pack order   24 cards x 5 bits  120 bits
+ *   dealer                            2 bits
+ *   passes before trump was made      4 bits
+ *   trump suit                        2 bits
+ *   dealer's discard                  5 bits  (31 if trump made in round 2)
+ *   cards played 20 cards x 5 bits  100 bits
+ *
+ * which is 233 bits, padded to HAND_RECORD_BYTES bytes so hand h of a game
+ * can be found without decoding the hands before it.  Who played each card
+ * and who took each trick follow from the plays and the rules, so they are
+ * not stored.
+ *
+ * Games written one after another to the same stream can be read back one
+ * at a time with read().
+ */
+
+#include "Card.hpp"
+#include "PackedCard.hpp"
+#include <array>
+#include <cstdint>
+#include <iostream>
+#include <string>
+#include <vector>
+
+// One hand of a game, decoded
+struct HandLog {
+  // Number of cards in the pack
+  static const int PACK_CARDS = 24;
+  // Number of cards played in a hand, five tricks of four cards
+  static const int PLAYS = 20;
+  // passes when nobody ordered up and the dealer had to
+  static const int DEALER_FORCED = 8;
+
+  std::array<PackedCard, PACK_CARDS> pack; // order before dealing
+  int dealer;  // seat of the dealer, 0..3
+  int passes;  // players who passed before trump was made, 0..7, or
+               // DEALER_FORCED.  Fewer than four passes means round one.
+  Suit trump;
+  int discard; // Pack index of the card the dealer discarded after an
+               // order up in round one, -1 if trump was made in round two
+  std::array<PackedCard, PLAYS> plays; // cards in the order played
+};
+
+class GameLog {
+public:
+  // Bytes used by one hand
+  static const int HAND_RECORD_BYTES = 30;
+
+  // EFFECTS: Initializes an empty log with no players
+  GameLog();
+
+  // REQUIRES: names has four entries, in seat order
+  // MODIFIES: this
+  // EFFECTS: Starts the log of a new game, discarding any hands logged
+  void start(const std::vector<std::string> &names, int points);
+
+  // REQUIRES: each field of hand is in the range described in HandLog
+  // MODIFIES: this
+  // EFFECTS: Appends hand to the log
+  void add_hand(const HandLog &hand);
+
+  // EFFECTS: Returns the number of hands logged
+  int num_hands() const;
+
+  // REQUIRES: 0 <= index < num_hands()
+  // EFFECTS: Returns the hand at index, decoded
+  HandLog get_hand(int index) const;
+
+  // REQUIRES: 0 <= seat < 4
+  // EFFECTS: Returns the name of the player in seat
+  const std::string & get_name(int seat) const;
+
+  // EFFECTS: Returns the points needed to win the game
+  int get_points_to_win() const;
+
+  // EFFECTS: Returns the number of bytes write() produces
+  std::size_t size_in_bytes() const;
+
+  // MODIFIES: os
+  // EFFECTS: Writes the log to os in binary
+  void write(std::ostream &os) const;
+
+  // MODIFIES: this, is
+  // EFFECTS: Reads the next game written by write() from is.  Returns false,
+  //          leaving this unspecified, if is has no complete game left or
+  //          the game read is not a valid log: a field out of its range in
+  //          HandLog, a pack without every card once, a discard the dealer
+  //          did not hold, or a card played by a seat that did not hold it
+  //          or that could have followed suit and did not.  Neither the
+  //          bids nor whether the game was finished are checked.
+  bool read(std::istream &is);
+
+private:
+  std::array<std::string, 4> names;
+  int points_to_win;
+  // Encoded hands, HAND_RECORD_BYTES each
+  std::vector<uint8_t> hands;
+};
+
+#endif // GAMELOG_HPP
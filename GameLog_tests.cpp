@@ -0,0 +1,262 @@
+#include "GameLog.hpp"
+#include "Game.hpp"
+#include "CardSet.hpp"
+#include "DoubleDummy.hpp"
+#include "unit_test_framework.hpp"
+#include <fstream>
+#include <iostream>
+#include <sstream>
+#include <string>
+
+using namespace std;
+
+const vector<string> NAMES = { "Adi", "Barbara", "Chi-Chih", "Dabbala" };
+
+//a hand with every field set, plays in the reverse of the pack order
+HandLog make_hand(int dealer, int passes, Suit trump, int discard) {
+    HandLog hand;
+    for (int i = 0; i < HandLog::PACK_CARDS; ++i) {
+        hand.pack[i] = PackedCard((i * 7) % HandLog::PACK_CARDS);
+    }
+    hand.dealer = dealer;
+    hand.passes = passes;
+    hand.trump = trump;
+    hand.discard = discard;
+    for (int i = 0; i < HandLog::PLAYS; ++i) {
+        hand.plays[i] = PackedCard(HandLog::PACK_CARDS - 1 - i);
+    }
+    return hand;
+}
+
+//the cards each seat holds for the play of hand, dealt 3-2-3-2 then
+//2-3-2-3 from the left of the dealer, who picks up the upcard in round 1
+array<CardSet, 4> held_cards(const HandLog &hand) {
+    const int PACKETS[] = { 3, 2, 3, 2, 2, 3, 2, 3 };
+    array<CardSet, 4> hands;
+    int position = 0;
+    for (int packet = 0; packet < 8; ++packet) {
+        for (int i = 0; i < PACKETS[packet]; ++i) {
+            int seat = (hand.dealer + 1 + packet) % 4;
+            hands[seat].insert(hand.pack[position++].to_card());
+        }
+    }
+    if (hand.discard >= 0) {
+        hands[hand.dealer].insert(hand.pack[20].to_card());
+        hands[hand.dealer].erase(PackedCard(hand.discard).to_card());
+    }
+    return hands;
+}
+
+//make_hand with plays that follow the rules: every seat plays its lowest
+//legal card
+HandLog make_legal_hand(int dealer, int passes, Suit trump, int discard) {
+    HandLog hand = make_hand(dealer, passes, trump, discard);
+    PlayState state(held_cards(hand), trump, (dealer + 1) % 4);
+    for (PackedCard &card : hand.plays) {
+        card = PackedCard(state.legal_cards().lowest());
+        state.play(card);
+    }
+    return hand;
+}
+
+void assert_same_hand(const HandLog &expected, const HandLog &actual) {
+    for (int i = 0; i < HandLog::PACK_CARDS; ++i) {
+        ASSERT_TRUE(expected.pack[i] == actual.pack[i]);
+    }
+    ASSERT_EQUAL(expected.dealer, actual.dealer);
+    ASSERT_EQUAL(expected.passes, actual.passes);
+    ASSERT_EQUAL(expected.trump, actual.trump);
+    ASSERT_EQUAL(expected.discard, actual.discard);
+    for (int i = 0; i < HandLog::PLAYS; ++i) {
+        ASSERT_TRUE(expected.plays[i] == actual.plays[i]);
+    }
+}
+
+TEST(test_hand_round_trip) {
+    GameLog log;
+    log.start(NAMES, 10);
+    HandLog first = make_hand(3, 0, DIAMONDS, 23);
+    HandLog second = make_hand(0, HandLog::DEALER_FORCED, SPADES, -1);
+    log.add_hand(first);
+    log.add_hand(second);
+    ASSERT_EQUAL(2, log.num_hands());
+    assert_same_hand(first, log.get_hand(0));
+    assert_same_hand(second, log.get_hand(1));
+    ASSERT_EQUAL(10, log.get_points_to_win());
+    ASSERT_EQUAL("Chi-Chih", log.get_name(2));
+}
+
+TEST(test_write_read_games) {
+    GameLog first;
+    first.start(NAMES, 1);
+    first.add_hand(make_legal_hand(1, 5, HEARTS, -1));
+    GameLog second;
+    second.start({ "Ivan", "", "Kunle", "Liskov" }, 300);
+    second.add_hand(make_legal_hand(2, 3, CLUBS, 20));
+    second.add_hand(make_legal_hand(3, 7, SPADES, -1));
+
+    ostringstream out;
+    first.write(out);
+    second.write(out);
+    ASSERT_EQUAL(out.str().size(),
+                 first.size_in_bytes() + second.size_in_bytes());
+
+    istringstream in(out.str());
+    GameLog read_log;
+    ASSERT_TRUE(read_log.read(in));
+    ASSERT_EQUAL(1, read_log.num_hands());
+    assert_same_hand(first.get_hand(0), read_log.get_hand(0));
+    ASSERT_TRUE(read_log.read(in));
+    ASSERT_EQUAL(300, read_log.get_points_to_win());
+    ASSERT_EQUAL("", read_log.get_name(1));
+    ASSERT_EQUAL(2, read_log.num_hands());
+    assert_same_hand(second.get_hand(1), read_log.get_hand(1));
+    ASSERT_FALSE(read_log.read(in));
+}
+
+TEST(test_read_truncated) {
+    GameLog log;
+    log.start(NAMES, 5);
+    log.add_hand(make_hand(0, 1, CLUBS, 4));
+    ostringstream out;
+    log.write(out);
+    string bytes = out.str();
+    istringstream in(bytes.substr(0, bytes.size() - 1));
+    GameLog read_log;
+    ASSERT_FALSE(read_log.read(in));
+}
+
+//reads one game from bytes after setting bits [first, first + width) of
+//its first hand record to value
+bool read_corrupted(string bytes, int first, int width, unsigned value) {
+    size_t hand_start = bytes.size() - GameLog::HAND_RECORD_BYTES;
+    for (int bit = 0; bit < width; ++bit) {
+        char &byte = bytes[hand_start + (first + bit) / 8];
+        int mask = 1 << ((first + bit) % 8);
+        byte = (value >> bit & 1) ? (byte | mask) : (byte & ~mask);
+    }
+    istringstream in(bytes);
+    GameLog log;
+    return log.read(in);
+}
+
+//fields out of range are rejected rather than handed to the replay
+TEST(test_read_corrupt) {
+    GameLog log;
+    log.start(NAMES, 5);
+    HandLog hand = make_legal_hand(0, 1, CLUBS, 20);
+    log.add_hand(hand);
+    ostringstream out;
+    log.write(out);
+    string bytes = out.str();
+    const int PASSES = 122;
+    const int DISCARD = 128;
+    const int PLAYS = 133;
+    const unsigned first_play = hand.plays[0].index();
+    ASSERT_TRUE(read_corrupted(bytes, 0, 5, 0));
+    ASSERT_FALSE(read_corrupted(bytes, 0, 5, 24));     // card past the pack
+    ASSERT_FALSE(read_corrupted(bytes, 5, 5, 0));      // card dealt twice
+    ASSERT_FALSE(read_corrupted(bytes, PASSES, 4, 9)); // too many passes
+    ASSERT_FALSE(read_corrupted(bytes, PASSES, 4, 5)); // round 2 discard
+    ASSERT_FALSE(read_corrupted(bytes, DISCARD, 5, 24));
+    ASSERT_FALSE(read_corrupted(bytes, DISCARD, 5, 31)); // round 1, none
+    ASSERT_FALSE(read_corrupted(bytes, PLAYS, 5, 30));
+    ASSERT_FALSE(read_corrupted(bytes, PLAYS + 5, 5, first_play)); // twice
+
+    string no_points = bytes;
+    no_points[1] = no_points[2] = 0;
+    istringstream in(no_points);
+    ASSERT_FALSE(log.read(in));
+}
+
+//reads one game holding hand
+bool read_hand(const HandLog &hand) {
+    GameLog log;
+    log.start(NAMES, 5);
+    log.add_hand(hand);
+    ostringstream out;
+    log.write(out);
+    istringstream in(out.str());
+    return log.read(in);
+}
+
+//plays and discards must be possible with the cards dealt
+TEST(test_read_impossible_plays) {
+    HandLog hand = make_legal_hand(0, 1, CLUBS, 20);
+    ASSERT_TRUE(read_hand(hand));
+    array<CardSet, 4> held = held_cards(hand);
+
+    // the leader, seat 1, leads a card dealt to seat 2
+    HandLog tampered = hand;
+    tampered.plays[0] = PackedCard(held[2].lowest());
+    ASSERT_FALSE(read_hand(tampered));
+
+    // the dealer discards a card dealt to seat 1
+    tampered = hand;
+    tampered.discard = hand.pack[0].index();
+    ASSERT_FALSE(read_hand(tampered));
+
+    // a seat plays off suit while holding the led suit: swap one of its
+    // forced plays with a later play of another suit
+    PlayState state(held, hand.trump, 1);
+    bool found = false;
+    for (int i = 0; i < HandLog::PLAYS && !found; ++i) {
+        int seat = state.to_move();
+        CardSet off_suit = state.hands[seat] - state.legal_cards();
+        for (int j = i + 4; j < HandLog::PLAYS && !found; ++j) {
+            if (off_suit.contains(hand.plays[j].to_card())) {
+                tampered = hand;
+                swap(tampered.plays[i], tampered.plays[j]);
+                found = true;
+            }
+        }
+        state.play(hand.plays[i]);
+    }
+    ASSERT_TRUE(found);
+    ASSERT_FALSE(read_hand(tampered));
+}
+
+//a logged game records the pack, bids and discards of every hand
+TEST(test_game_log) {
+    vector<Player*> players;
+    for (const string &name : NAMES) {
+        players.push_back(Player_factory(name, "Simple"));
+    }
+    ShuffleSetting in_shuffle = { ShuffleSetting::IN_SHUFFLE, 0, 0 };
+    NullSink sink;
+    Game game({ Pack(), in_shuffle, 10 }, players, sink);
+    GameLog log;
+    game.set_log(&log);
+    GameResult result = game.play();
+
+    ASSERT_EQUAL(result.hands, log.num_hands());
+    ASSERT_EQUAL(10, log.get_points_to_win());
+    ASSERT_EQUAL(log.size_in_bytes(),
+                 1 + 2 + 4 + 25 + 2 + 30 * static_cast<size_t>(result.hands));
+    Pack pack;
+    for (int h = 0; h < log.num_hands(); ++h) {
+        HandLog hand = log.get_hand(h);
+        pack.shuffle();
+        for (int i = 0; i < HandLog::PACK_CARDS; ++i) {
+            ASSERT_TRUE(pack.card_at(i) == hand.pack[i]);
+        }
+        ASSERT_EQUAL(h % 4, hand.dealer);
+        // every dealt card except the discard is played once
+        CardSet played;
+        for (PackedCard card : hand.plays) {
+            ASSERT_FALSE(played.contains(card.to_card()));
+            played.insert(card.to_card());
+        }
+        ASSERT_EQUAL(hand.passes >= 4, hand.discard == -1);
+        if (hand.discard >= 0) {
+            ASSERT_FALSE(played.contains(PackedCard(hand.discard).to_card()));
+            ASSERT_TRUE(played.contains(hand.pack[20].to_card()) ||
+                        hand.discard == hand.pack[20].index());
+        }
+    }
+    for (Player *player : players) {
+        delete player;
+    }
+}
+
+TEST_MAIN()
@@ -0,0 +1,138 @@
+#include "GameStats.hpp"
+#include <cassert>
+#include <cmath>
+#include <iomanip>
+#include <iostream>
+
+using namespace std;
+
+namespace {
+
+// Standard normal quantile for a two-sided 95% interval
+const double Z_95 = 1.96;
+
+// EFFECTS: Prints one statistic as its mean, confidence interval and
+//          standard deviation
+void print_stat(ostream &os, const string &label, const RunningStat &stat) {
+  os << label << ' ' << stat.get_mean() << " +/- "
+     << stat.get_confidence_95() << " (sd " << sqrt(stat.get_variance())
+     << ", n " << stat.get_count() << ")\n";
+}
+
+} // namespace
+
+// RunningStat implementation
+RunningStat::RunningStat()
+  : count(0), mean(0), squares(0) {}
+
+void RunningStat::add(double x, long long times) {
+  assert(times >= 0);
+  if (times == 1) {
+    // Welford's update
+    count++;
+    double delta = x - mean;
+    mean += delta / count;
+    squares += delta * (x - mean);
+    return;
+  }
+  RunningStat same;
+  same.count = times;
+  same.mean = x;
+  merge(same);
+}
+
+void RunningStat::merge(const RunningStat &other) {
+  if (other.count == 0) {
+    return;
+  }
+  long long total = count + other.count;
+  double delta = other.mean - mean;
+  mean += delta * other.count / total;
+  squares += other.squares +
+    delta * delta * (static_cast<double>(count) * other.count / total);
+  count = total;
+}
+
+long long RunningStat::get_count() const {
+  return count;
+}
+
+double RunningStat::get_mean() const {
+  return mean;
+}
+
+double RunningStat::get_variance() const {
+  if (count < 2) {
+    return 0;
+  }
+  return squares / (count - 1);
+}
+
+double RunningStat::get_confidence_95() const {
+  if (count < 2) {
+    return 0;
+  }
+  return Z_95 * sqrt(get_variance() / count);
+}
+
+// GameStats implementation
+void GameStats::add(const GameResult &result) {
+  wins[result.winning_team].add(1);
+  wins[1 - result.winning_team].add(0);
+  hands_per_game.add(result.hands);
+  // Every hand scores 2 points for a euchre or a march and 1 otherwise, so
+  // a game's hands are added a value at a time
+  euchres.add(1, result.euchres);
+  euchres.add(0, result.hands - result.euchres);
+  marches.add(1, result.marches);
+  marches.add(0, result.hands - result.marches);
+  int two_point_hands = result.euchres + result.marches;
+  points_per_hand.add(2, two_point_hands);
+  points_per_hand.add(1, result.hands - two_point_hands);
+}
+
+void GameStats::merge(const GameStats &other) {
+  wins[0].merge(other.wins[0]);
+  wins[1].merge(other.wins[1]);
+  euchres.merge(other.euchres);
+  marches.merge(other.marches);
+  points_per_hand.merge(other.points_per_hand);
+  hands_per_game.merge(other.hands_per_game);
+}
+
+const RunningStat & GameStats::get_wins(int team) const {
+  assert(team == 0 || team == 1);
+  return wins[team];
+}
+
+const RunningStat & GameStats::get_euchres() const {
+  return euchres;
+}
+
+const RunningStat & GameStats::get_marches() const {
+  return marches;
+}
+
+const RunningStat & GameStats::get_points_per_hand() const {
+  return points_per_hand;
+}
+
+const RunningStat & GameStats::get_hands_per_game() const {
+  return hands_per_game;
+}
+
+void GameStats::print(ostream &os, const vector<Player*> &players) const {
+  ios::fmtflags flags = os.flags();
+  streamsize precision = os.precision();
+  os << fixed << setprecision(4);
+  for (int team = 0; team < 2; ++team) {
+    print_stat(os, players[team]->get_name() + " and " +
+               players[team + 2]->get_name() + " win rate", wins[team]);
+  }
+  print_stat(os, "euchre rate", euchres);
+  print_stat(os, "march rate", marches);
+  print_stat(os, "points per hand", points_per_hand);
+  print_stat(os, "hands per game", hands_per_game);
+  os.flags(flags);
+  os.precision(precision);
+}
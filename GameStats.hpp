@@ -0,0 +1,94 @@
+#ifndef GAMESTATS_HPP
+#define GAMESTATS_HPP
+/* GameStats.hpp
+ *
+ * Streaming statistics over many games, for runs too large to keep every
+ * result: each game's outcome is folded into running means and variances
+ * (Welford's method) in constant memory and a single pass, and two sets of
+ * statistics merge exactly (Chan et al.'s pairwise update), so each
+ * Tournament worker can keep its own and they are combined at the end.
+ *
+ * Confidence intervals are the normal approximation, mean +/- 1.96
+ * standard errors, which is sound for the thousands of games a batch
+ * plays.  Per-hand rates treat the hands of a run as independent.
+ */
+
+#include "Game.hpp"
+#include "Player.hpp"
+#include <iosfwd>
+#include <vector>
+
+// Count, mean and variance of a stream of numbers
+class RunningStat {
+public:
+  // EFFECTS: Initializes a statistic of no observations
+  RunningStat();
+
+  // REQUIRES: times >= 0
+  // EFFECTS: Adds times observations of value x
+  void add(double x, long long times = 1);
+
+  // EFFECTS: Adds every observation of other, with the same result as
+  //          adding them one at a time
+  void merge(const RunningStat &other);
+
+  // EFFECTS: Returns the number of observations
+  long long get_count() const;
+
+  // EFFECTS: Returns the mean of the observations, 0 if there are none
+  double get_mean() const;
+
+  // EFFECTS: Returns the sample variance of the observations, 0 if there
+  //          are fewer than two
+  double get_variance() const;
+
+  // EFFECTS: Returns the half-width of the 95% confidence interval of the
+  //          mean, 0 if there are fewer than two observations
+  double get_confidence_95() const;
+
+private:
+  long long count;
+  double mean;
+  double squares; // sum of squared differences from the mean
+};
+
+// Rates and averages of the outcomes of many games
+class GameStats {
+public:
+  // EFFECTS: Adds the outcome of one game
+  void add(const GameResult &result);
+
+  // EFFECTS: Adds every game counted in other
+  void merge(const GameStats &other);
+
+  // REQUIRES: team is 0 or 1
+  // EFFECTS: Returns the win rate of team, over games.  Both players of a
+  //          team share it, so it is also the win rate of their seats.
+  const RunningStat & get_wins(int team) const;
+
+  // EFFECTS: Returns the rate of hands won by the defenders, over hands
+  const RunningStat & get_euchres() const;
+
+  // EFFECTS: Returns the rate of hands where the makers took every trick,
+  //          over hands
+  const RunningStat & get_marches() const;
+
+  // EFFECTS: Returns the points scored per hand, over hands
+  const RunningStat & get_points_per_hand() const;
+
+  // EFFECTS: Returns the hands played per game, over games
+  const RunningStat & get_hands_per_game() const;
+
+  // REQUIRES: players has four players, in seat order
+  // EFFECTS: Prints every statistic with its 95% confidence interval to os
+  void print(std::ostream &os, const std::vector<Player*> &players) const;
+
+private:
+  RunningStat wins[2];
+  RunningStat euchres;
+  RunningStat marches;
+  RunningStat points_per_hand;
+  RunningStat hands_per_game;
+};
+
+#endif // GAMESTATS_HPP
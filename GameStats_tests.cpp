@@ -0,0 +1,140 @@
+#include "Game.hpp"
+#include "GameStats.hpp"
+#include "Player.hpp"
+#include "Tournament.hpp"
+#include "unit_test_framework.hpp"
+#include <cmath>
+#include <sstream>
+#include <string>
+#include <vector>
+
+using namespace std;
+
+const vector<string> NAMES = { "Adi", "Barbara", "Chi-Chih", "Dabbala" };
+const ShuffleSetting RANDOM = { ShuffleSetting::RANDOM, 280, 0 };
+const double EPSILON = 1e-9;
+
+TEST(test_running_stat_empty) {
+    RunningStat stat;
+    ASSERT_EQUAL(stat.get_count(), 0);
+    ASSERT_EQUAL(stat.get_mean(), 0.0);
+    ASSERT_EQUAL(stat.get_variance(), 0.0);
+    ASSERT_EQUAL(stat.get_confidence_95(), 0.0);
+    stat.add(3);
+    ASSERT_EQUAL(stat.get_mean(), 3.0);
+    ASSERT_EQUAL(stat.get_variance(), 0.0);
+}
+
+//mean 5 and sample variance 32 / 7
+TEST(test_running_stat_values) {
+    RunningStat stat;
+    const double values[] = { 2, 4, 4, 4, 5, 5, 7, 9 };
+    for (double x : values) {
+        stat.add(x);
+    }
+    ASSERT_EQUAL(stat.get_count(), 8);
+    ASSERT_ALMOST_EQUAL(stat.get_mean(), 5.0, EPSILON);
+    ASSERT_ALMOST_EQUAL(stat.get_variance(), 32.0 / 7, EPSILON);
+    ASSERT_ALMOST_EQUAL(stat.get_confidence_95(),
+                        1.96 * sqrt(32.0 / 7 / 8), EPSILON);
+}
+
+//adding a value several times at once, or merging two halves, is the same
+//as adding the values one at a time
+TEST(test_running_stat_merge) {
+    RunningStat one_at_a_time;
+    RunningStat repeated;
+    RunningStat first;
+    RunningStat second;
+    for (int i = 0; i < 5; ++i) {
+        one_at_a_time.add(1.5);
+        first.add(1.5);
+    }
+    for (int i = 0; i < 3; ++i) {
+        one_at_a_time.add(-2);
+        second.add(-2);
+    }
+    one_at_a_time.add(10);
+    second.add(10);
+    repeated.add(1.5, 5);
+    repeated.add(-2, 3);
+    repeated.add(10, 1);
+    repeated.add(7, 0);
+    first.merge(second);
+    first.merge(RunningStat());
+
+    for (const RunningStat &stat : { repeated, first }) {
+        ASSERT_EQUAL(stat.get_count(), one_at_a_time.get_count());
+        ASSERT_ALMOST_EQUAL(stat.get_mean(), one_at_a_time.get_mean(),
+                            EPSILON);
+        ASSERT_ALMOST_EQUAL(stat.get_variance(),
+                            one_at_a_time.get_variance(), EPSILON);
+    }
+}
+
+TEST(test_game_stats_add) {
+    GameStats stats;
+    GameResult first = { 0, 4, 1, 1, { 10, 3 } };
+    GameResult second = { 1, 6, 0, 2, { 7, 10 } };
+    stats.add(first);
+    stats.add(second);
+    ASSERT_EQUAL(stats.get_wins(0).get_count(), 2);
+    ASSERT_ALMOST_EQUAL(stats.get_wins(0).get_mean(), 0.5, EPSILON);
+    ASSERT_ALMOST_EQUAL(stats.get_wins(1).get_mean(), 0.5, EPSILON);
+    ASSERT_EQUAL(stats.get_euchres().get_count(), 10);
+    ASSERT_ALMOST_EQUAL(stats.get_euchres().get_mean(), 0.1, EPSILON);
+    ASSERT_ALMOST_EQUAL(stats.get_marches().get_mean(), 0.3, EPSILON);
+    ASSERT_ALMOST_EQUAL(stats.get_points_per_hand().get_mean(), 1.4, EPSILON);
+    ASSERT_ALMOST_EQUAL(stats.get_hands_per_game().get_mean(), 5.0, EPSILON);
+    ASSERT_ALMOST_EQUAL(stats.get_hands_per_game().get_variance(), 2.0,
+                        EPSILON);
+}
+
+//the statistics of a tournament do not depend on the number of threads,
+//and agree with its totals
+TEST(test_game_stats_tournament) {
+    vector<string> strategies(4, "Simple");
+    Tournament tournament({ Pack(), RANDOM, 10 }, NAMES, strategies);
+    GameStats one;
+    GameStats many;
+    GameTotals totals = tournament.run(200, 1, &one);
+    tournament.run(200, 3, &many);
+
+    ASSERT_EQUAL(one.get_wins(0).get_count(), 200);
+    ASSERT_ALMOST_EQUAL(one.get_wins(0).get_mean(),
+                        totals.get_wins(0) / 200.0, EPSILON);
+    ASSERT_ALMOST_EQUAL(one.get_hands_per_game().get_mean(),
+                        totals.get_average_hands(), EPSILON);
+    long long hands = one.get_euchres().get_count();
+    ASSERT_ALMOST_EQUAL(one.get_euchres().get_mean() * hands,
+                        static_cast<double>(totals.get_euchres()), 1e-6);
+    const RunningStat *pairs[][2] = {
+        { &one.get_wins(0), &many.get_wins(0) },
+        { &one.get_euchres(), &many.get_euchres() },
+        { &one.get_marches(), &many.get_marches() },
+        { &one.get_points_per_hand(), &many.get_points_per_hand() },
+        { &one.get_hands_per_game(), &many.get_hands_per_game() },
+    };
+    for (auto &pair : pairs) {
+        ASSERT_EQUAL(pair[0]->get_count(), pair[1]->get_count());
+        ASSERT_ALMOST_EQUAL(pair[0]->get_mean(), pair[1]->get_mean(),
+                            EPSILON);
+        ASSERT_ALMOST_EQUAL(pair[0]->get_variance(),
+                            pair[1]->get_variance(), EPSILON);
+    }
+
+    vector<Player*> players;
+    for (const string &name : NAMES) {
+        players.push_back(Player_factory(name, "Simple"));
+    }
+    ostringstream report;
+    one.print(report, players);
+    ASSERT_TRUE(report.str().find("Adi and Chi-Chih win rate") !=
+                string::npos);
+    ASSERT_TRUE(report.str().find("euchre rate") != string::npos);
+    for (Player *player : players) {
+        delete player;
+    }
+}
+
+TEST_MAIN()
@@ -0,0 +1,199 @@
+#include "Game.hpp"
+#include "MonteCarlo.hpp"
+#include "Simple.hpp"
+#include "unit_test_framework.hpp"
+#include <cstdlib>
+#include <iostream>
+#include <new>
+#include <sstream>
+#include <string>
+#include <vector>
+
+using namespace std;
+
+const vector<string> NAMES = { "Adi", "Barbara", "Chi-Chih", "Dabbala" };
+
+//every heap allocation in this program is counted here
+long long allocations = 0;
+
+void * operator new(size_t size) {
+    ++allocations;
+    void *memory = malloc(size > 0 ? size : 1);
+    if (!memory) {
+        throw bad_alloc();
+    }
+    return memory;
+}
+
+void operator delete(void *memory) noexcept {
+    free(memory);
+}
+
+void operator delete(void *memory, size_t) noexcept {
+    free(memory);
+}
+
+//the transcript, result and log of one game
+struct Outcome {
+    string transcript;
+    GameResult result;
+    string log;
+};
+
+template <typename Seats>
+Outcome play_game(const Seats &seats, const ShuffleSetting &shuffle,
+                  int points, const ShuffleCycle *cycle = nullptr) {
+    MemorySink sink;
+    BasicGame<Seats> game({ Pack(), shuffle, points, cycle }, seats, sink);
+    GameLog log;
+    game.set_log(&log);
+    Outcome outcome;
+    outcome.result = game.play();
+    outcome.transcript = sink.str();
+    ostringstream log_bytes;
+    log.write(log_bytes);
+    outcome.log = log_bytes.str();
+    return outcome;
+}
+
+void assert_same(const Outcome &lhs, const Outcome &rhs) {
+    ASSERT_EQUAL(lhs.transcript, rhs.transcript);
+    ASSERT_EQUAL(lhs.log, rhs.log);
+    ASSERT_EQUAL(lhs.result.winning_team, rhs.result.winning_team);
+    ASSERT_EQUAL(lhs.result.hands, rhs.result.hands);
+    ASSERT_EQUAL(lhs.result.euchres, rhs.result.euchres);
+    ASSERT_EQUAL(lhs.result.marches, rhs.result.marches);
+    ASSERT_EQUAL(lhs.result.scores[0], rhs.result.scores[0]);
+    ASSERT_EQUAL(lhs.result.scores[1], rhs.result.scores[1]);
+}
+
+//Simple players held by type play the same games as through Player*
+TEST(test_bot_game_simple_matches_game) {
+    const ShuffleSetting shuffles[] = {
+        { ShuffleSetting::NO_SHUFFLE, 0, 0 },
+        { ShuffleSetting::IN_SHUFFLE, 0, 0 },
+        { ShuffleSetting::RANDOM, 280, 0 },
+        { ShuffleSetting::RANDOM, 280, 7 },
+    };
+    for (const ShuffleSetting &shuffle : shuffles) {
+        vector<Player*> players;
+        for (const string &name : NAMES) {
+            players.push_back(Player_factory(name, "Simple"));
+        }
+        Outcome virtual_game = play_game(players, shuffle, 10);
+
+        Simple adi(NAMES[0]), barbara(NAMES[1]);
+        Simple chi_chih(NAMES[2]), dabbala(NAMES[3]);
+        BotSeats<Simple> seats(adi, barbara, chi_chih, dabbala);
+        Outcome bot_game = play_game(seats, shuffle, 10);
+
+        assert_same(virtual_game, bot_game);
+        for (Player *player : players) {
+            delete player;
+        }
+    }
+}
+
+//the packs of a shared cycle are the packs of shuffling one hand at a
+//time, also in games long enough to go around the cycle
+TEST(test_shuffle_cycle_matches_shuffling) {
+    ShuffleCycle cycle{Pack()};
+    Pack shuffled;
+    for (int hand = 0; hand < 2 * Pack::SHUFFLE_CYCLE_LENGTH; ++hand) {
+        shuffled.shuffle();
+        for (int i = 0; i < HandLog::PACK_CARDS; ++i) {
+            ASSERT_EQUAL(shuffled.card_at(i), cycle.get_pack(hand).card_at(i));
+        }
+    }
+
+    vector<Player*> players;
+    for (const string &name : NAMES) {
+        players.push_back(Player_factory(name, "Simple"));
+    }
+    const ShuffleSetting shuffle = { ShuffleSetting::IN_SHUFFLE, 0, 0 };
+    Outcome shuffling = play_game(players, shuffle, 40);
+    Outcome cached = play_game(players, shuffle, 40, &cycle);
+    ASSERT_TRUE(cached.result.hands > Pack::SHUFFLE_CYCLE_LENGTH);
+    assert_same(shuffling, cached);
+    for (Player *player : players) {
+        delete player;
+    }
+}
+
+//each team can have its own strategy, and players hear about the hand
+TEST(test_bot_game_two_strategies) {
+    const ShuffleSetting shuffle = { ShuffleSetting::RANDOM, 280, 3 };
+    vector<Player*> players = {
+        Player_factory(NAMES[0], "MonteCarlo:2"),
+        Player_factory(NAMES[1], "Simple"),
+        Player_factory(NAMES[2], "MonteCarlo:2"),
+        Player_factory(NAMES[3], "Simple"),
+    };
+    Outcome virtual_game = play_game(players, shuffle, 3);
+
+    MonteCarlo adi(NAMES[0], 2), chi_chih(NAMES[2], 2);
+    Simple barbara(NAMES[1]), dabbala(NAMES[3]);
+    BotSeats<MonteCarlo, Simple> seats(adi, barbara, chi_chih, dabbala);
+    Outcome bot_game = play_game(seats, shuffle, 3);
+
+    assert_same(virtual_game, bot_game);
+    for (Player *player : players) {
+        delete player;
+    }
+}
+
+//one set of Simple players can play game after game
+TEST(test_bot_game_players_reused) {
+    Simple adi(NAMES[0]), barbara(NAMES[1]);
+    Simple chi_chih(NAMES[2]), dabbala(NAMES[3]);
+    BotSeats<Simple> seats(adi, barbara, chi_chih, dabbala);
+    vector<Player*> players;
+    for (const string &name : NAMES) {
+        players.push_back(Player_factory(name, "Simple"));
+    }
+    for (uint64_t stream = 0; stream < 20; ++stream) {
+        const ShuffleSetting shuffle = { ShuffleSetting::RANDOM, 5, stream };
+        assert_same(play_game(players, shuffle, 10),
+                    play_game(seats, shuffle, 10));
+    }
+    for (Player *player : players) {
+        delete player;
+    }
+}
+
+//once a game is set up, dealing, bidding, playing the tricks and scoring
+//never touch the heap, whichever way the players are held
+TEST(test_hands_do_not_allocate) {
+    vector<Player*> players;
+    for (const string &name : NAMES) {
+        players.push_back(Player_factory(name, "Simple"));
+    }
+    Simple adi(NAMES[0]), barbara(NAMES[1]);
+    Simple chi_chih(NAMES[2]), dabbala(NAMES[3]);
+    BotSeats<Simple> seats(adi, barbara, chi_chih, dabbala);
+    NullSink out;
+    const ShuffleSetting shuffles[] = {
+        { ShuffleSetting::NO_SHUFFLE, 0, 0 },
+        { ShuffleSetting::IN_SHUFFLE, 0, 0 },
+        { ShuffleSetting::RANDOM, 280, 0 },
+        { ShuffleSetting::RANDOM, 280, 1 },
+        { ShuffleSetting::RANDOM, 280, 2 },
+    };
+    for (const ShuffleSetting &shuffle : shuffles) {
+        Game game({ Pack(), shuffle, 10 }, players, out);
+        long long before = allocations;
+        GameResult result = game.play();
+        ASSERT_EQUAL(allocations, before);
+        ASSERT_TRUE(result.hands > 1);
+
+        BotGame<Simple> bot_game({ Pack(), shuffle, 10 }, seats, out);
+        before = allocations;
+        bot_game.play();
+        ASSERT_EQUAL(allocations, before);
+    }
+    for (Player *player : players) {
+        delete player;
+    }
+}
+
+TEST_MAIN()
@@ -0,0 +1,105 @@
+#ifndef HANDRANK_HPP
+#define HANDRANK_HPP
+/* HandRank.hpp
+ *
+ * Numbers every euchre hand of a given size densely, so tables about hands
+ * can be plain arrays indexed by hand, with no hashing.  Used for 5-card
+ * hands and for the dealer's 6 cards after picking up the upcard, but any
+ * size works.
+ *
+ * The number of a hand is its colex rank: with the hand's cards at
+ * positions c1 < c2 < ... < ck of the standard Pack order (the order of
+ * Pack::Pack(), which is also the CardSet bit order), the rank is
+ * C(c1, 1) + C(c2, 2) + ... + C(ck, k).  Colex order is the numeric order
+ * of the hands' bitboards, so next_hand() steps from rank r to rank r + 1
+ * with a few bit operations, and enumerating every hand of a size needs
+ * neither ranking nor unranking.
+ */
+
+#include "CardSet.hpp"
+#include <array>
+#include <cstdint>
+
+namespace hand_rank_detail {
+  const int NUM_CARDS = CardSet::NUM_CARDS;
+
+  // BINOMIAL[n][k] is n choose k, for n up to the size of the pack
+  typedef std::array<std::array<int, NUM_CARDS + 1>, NUM_CARDS + 1>
+    BinomialTable;
+
+  constexpr BinomialTable make_binomial_table() {
+    BinomialTable table = {};
+    for (int n = 0; n <= NUM_CARDS; ++n) {
+      table[n][0] = 1;
+      for (int k = 1; k <= n; ++k) {
+        table[n][k] = table[n - 1][k - 1] + (k < n ? table[n - 1][k] : 0);
+      }
+    }
+    return table;
+  }
+
+  constexpr BinomialTable BINOMIAL = make_binomial_table();
+
+  // EFFECTS: Returns the colex rank of the cards in bits
+  constexpr int rank_bits(uint32_t bits) {
+    int rank = 0;
+    for (int k = 1; bits; bits &= bits - 1, ++k) {
+      rank += BINOMIAL[__builtin_ctz(bits)][k];
+    }
+    return rank;
+  }
+
+  // EFFECTS: Returns the bits of the hand of size cards with colex rank
+  constexpr uint32_t unrank_bits(int rank, int size) {
+    uint32_t bits = 0;
+    // The highest card is the largest c with C(c, size) <= rank, and so on
+    int c = NUM_CARDS;
+    for (int k = size; k > 0; --k) {
+      do {
+        --c;
+      } while (BINOMIAL[c][k] > rank);
+      bits |= 1u << c;
+      rank -= BINOMIAL[c][k];
+    }
+    return bits;
+  }
+
+  // EFFECTS: Returns the next larger bitboard with as many bits as bits,
+  //          which must not be zero (Gosper's hack)
+  constexpr uint32_t next_bits(uint32_t bits) {
+    uint32_t lowest = bits & (0u - bits);
+    uint32_t ripple = bits + lowest;
+    return ripple | (((bits ^ ripple) >> 2) / lowest);
+  }
+}
+
+//REQUIRES 0 <= size <= CardSet::NUM_CARDS
+//EFFECTS Returns the number of different hands of size cards
+constexpr int num_hands(int size) {
+  return hand_rank_detail::BINOMIAL[hand_rank_detail::NUM_CARDS][size];
+}
+
+//EFFECTS Returns the colex rank of hand among the hands of its size, in
+//  [0, num_hands(hand.size()))
+inline int hand_rank(CardSet hand) {
+  return hand_rank_detail::rank_bits(hand.bits());
+}
+
+//REQUIRES 0 <= size <= CardSet::NUM_CARDS, 0 <= rank < num_hands(size)
+//EFFECTS Returns the hand of size cards whose colex rank is rank
+inline CardSet hand_unrank(int rank, int size) {
+  return CardSet(hand_rank_detail::unrank_bits(rank, size));
+}
+
+//EFFECTS Returns the hand of rank 0 among the hands of size cards
+inline CardSet first_hand(int size) {
+  return CardSet((1u << size) - 1);
+}
+
+//REQUIRES hand is not empty, and hand_rank(hand) + 1 < num_hands(hand.size())
+//EFFECTS Returns the hand of the same size whose rank is one higher
+inline CardSet next_hand(CardSet hand) {
+  return CardSet(hand_rank_detail::next_bits(hand.bits()));
+}
+
+#endif // HANDRANK_HPP
@@ -0,0 +1,94 @@
+#include "HandRank.hpp"
+#include "Pack.hpp"
+#include "unit_test_framework.hpp"
+#include <iostream>
+
+using namespace std;
+
+//the hands of one card are numbered in the order a new Pack deals them
+TEST(test_hand_rank_pack_order) {
+    Pack pack;
+    for (int i = 0; i < CardSet::NUM_CARDS; ++i) {
+        CardSet hand;
+        hand.insert(pack.deal_one());
+        ASSERT_EQUAL(i, hand_rank(hand));
+        ASSERT_TRUE(hand_unrank(i, 1).contains(CardSet::card_at(i)));
+    }
+}
+
+TEST(test_num_hands) {
+    ASSERT_EQUAL(1, num_hands(0));
+    ASSERT_EQUAL(24, num_hands(1));
+    ASSERT_EQUAL(42504, num_hands(5));
+    ASSERT_EQUAL(134596, num_hands(6));
+    ASSERT_EQUAL(1, num_hands(24));
+}
+
+//the first hand has the lowest cards of the pack, the last the highest
+TEST(test_hand_rank_ends) {
+    CardSet first;
+    first.insert(Card(NINE, SPADES));
+    first.insert(Card(TEN, SPADES));
+    first.insert(Card(JACK, SPADES));
+    first.insert(Card(QUEEN, SPADES));
+    first.insert(Card(KING, SPADES));
+    ASSERT_EQUAL(0, hand_rank(first));
+    ASSERT_EQUAL(first.bits(), first_hand(5).bits());
+    ASSERT_EQUAL(first.bits(), hand_unrank(0, 5).bits());
+
+    CardSet last;
+    last.insert(Card(TEN, DIAMONDS));
+    last.insert(Card(JACK, DIAMONDS));
+    last.insert(Card(QUEEN, DIAMONDS));
+    last.insert(Card(KING, DIAMONDS));
+    last.insert(Card(ACE, DIAMONDS));
+    ASSERT_EQUAL(num_hands(5) - 1, hand_rank(last));
+    ASSERT_EQUAL(last.bits(), hand_unrank(num_hands(5) - 1, 5).bits());
+}
+
+//walks every hand of size in order, checking that ranking and unranking
+//agree with the walk, so both are bijections onto [0, num_hands(size))
+void check_every_hand(int size) {
+    CardSet hand = first_hand(size);
+    for (int rank = 0; rank < num_hands(size); ++rank) {
+        ASSERT_EQUAL(size, hand.size());
+        ASSERT_EQUAL(rank, hand_rank(hand));
+        ASSERT_EQUAL(hand.bits(), hand_unrank(rank, size).bits());
+        if (rank + 1 < num_hands(size)) {
+            CardSet next = next_hand(hand);
+            ASSERT_TRUE(next.bits() > hand.bits());
+            hand = next;
+        }
+    }
+    ASSERT_EQUAL(0xFFFFFFu, hand.bits() | ((1u << (24 - size)) - 1));
+}
+
+TEST(test_every_five_card_hand) {
+    check_every_hand(5);
+}
+
+//the dealer's hand after picking up the upcard
+TEST(test_every_six_card_hand) {
+    check_every_hand(6);
+}
+
+TEST(test_every_small_hand) {
+    for (int size = 0; size <= 3; ++size) {
+        check_every_hand(size);
+    }
+}
+
+//Gosper's step visits bitboards in numeric order without skipping any
+TEST(test_next_hand_skips_nothing) {
+    CardSet hand = first_hand(3);
+    uint32_t bits = hand.bits();
+    for (int rank = 1; rank < num_hands(3); ++rank) {
+        do {
+            ++bits;
+        } while (__builtin_popcount(bits) != 3);
+        hand = next_hand(hand);
+        ASSERT_EQUAL(bits, hand.bits());
+    }
+}
+
+TEST_MAIN()
@@ -0,0 +1,177 @@
+#include "HandStrength.hpp"
+#include "PackedCard.hpp"
+#include <cstring>
+
+#if defined(__GNUC__) && (defined(__x86_64__) || defined(__i386__))
+#define HAND_STRENGTH_AVX2 1
+#include <immintrin.h>
+#endif
+
+using namespace std;
+
+namespace {
+
+static_assert(sizeof(SuitStrength) == 4 && sizeof(HandStrength) == 16,
+              "HandStrength is stored a 32-bit lane per trump suit");
+
+// The Ace of every suit
+const uint32_t ACE_MASK = cardset_detail::RANK_MASK << (ACE - NINE);
+
+struct TrumpMasks {
+  uint32_t trumps;
+  uint32_t bowers;
+  uint32_t faces;
+  uint32_t off_aces;
+};
+
+// EFFECTS: Returns the cards counted for each field of SuitStrength
+TrumpMasks trump_masks(Suit trump) {
+  uint32_t right = 1u << PackedCard(JACK, trump).index();
+  uint32_t left =
+    1u << PackedCard(JACK, PackedCard::next_suit(trump)).index();
+  uint32_t trumps = CardSet::trump_cards(trump).bits();
+  return { trumps, right | left, trumps & cardset_detail::FACE_OR_ACE_MASK,
+           ACE_MASK & ~trumps };
+}
+
+// EFFECTS: Returns the strength of hand with trump, packed the way
+//          SuitStrength lies in memory
+uint32_t packed_strength(uint32_t hand, const TrumpMasks &masks) {
+  SuitStrength strength = {
+    static_cast<uint8_t>(__builtin_popcount(hand & masks.trumps)),
+    static_cast<uint8_t>(__builtin_popcount(hand & masks.bowers)),
+    static_cast<uint8_t>(__builtin_popcount(hand & masks.faces)),
+    static_cast<uint8_t>(__builtin_popcount(hand & masks.off_aces))
+  };
+  uint32_t packed;
+  memcpy(&packed, &strength, sizeof(packed));
+  return packed;
+}
+
+#ifdef HAND_STRENGTH_AVX2
+
+#define AVX2_FUNCTION __attribute__((target("avx2")))
+
+// EFFECTS: Returns the number of bits set in each 32-bit lane of v
+AVX2_FUNCTION __m256i popcount_lanes(__m256i v) {
+  // Bits set in each value of a nibble, looked up per byte
+  const __m256i lookup = _mm256_setr_epi8(0, 1, 1, 2, 1, 2, 2, 3,
+                                          1, 2, 2, 3, 2, 3, 3, 4,
+                                          0, 1, 1, 2, 1, 2, 2, 3,
+                                          1, 2, 2, 3, 2, 3, 3, 4);
+  const __m256i low_nibbles = _mm256_set1_epi8(0x0F);
+  __m256i low = _mm256_and_si256(v, low_nibbles);
+  __m256i high = _mm256_and_si256(_mm256_srli_epi16(v, 4), low_nibbles);
+  __m256i bytes = _mm256_add_epi8(_mm256_shuffle_epi8(lookup, low),
+                                  _mm256_shuffle_epi8(lookup, high));
+  // Sum the four bytes of each lane into its lowest byte
+  bytes = _mm256_add_epi8(bytes, _mm256_srli_epi32(bytes, 8));
+  bytes = _mm256_add_epi8(bytes, _mm256_srli_epi32(bytes, 16));
+  return _mm256_and_si256(bytes, _mm256_set1_epi32(0xFF));
+}
+
+// EFFECTS: Returns the count of hand & mask in each lane
+AVX2_FUNCTION __m256i count_lanes(__m256i hand, uint32_t mask) {
+  return popcount_lanes(
+    _mm256_and_si256(hand, _mm256_set1_epi32(static_cast<int>(mask))));
+}
+
+// EFFECTS: Returns the packed strength of each lane of hand with trump
+AVX2_FUNCTION __m256i packed_strength_lanes(__m256i hand,
+                                            const TrumpMasks &masks) {
+  __m256i packed = count_lanes(hand, masks.trumps);
+  packed = _mm256_or_si256(
+    packed, _mm256_slli_epi32(count_lanes(hand, masks.bowers), 8));
+  packed = _mm256_or_si256(
+    packed, _mm256_slli_epi32(count_lanes(hand, masks.faces), 16));
+  return _mm256_or_si256(
+    packed, _mm256_slli_epi32(count_lanes(hand, masks.off_aces), 24));
+}
+
+// REQUIRES: hands and out each hold count elements
+// MODIFIES: out
+// EFFECTS: evaluate_hands with AVX2, eight hands at a time
+AVX2_FUNCTION void evaluate_hands_avx2(const CardSet *hands, int count,
+                                       HandStrength *out) {
+  TrumpMasks masks[4];
+  for (int s = SPADES; s <= DIAMONDS; ++s) {
+    masks[s] = trump_masks(static_cast<Suit>(s));
+  }
+  int i = 0;
+  for (; i + 8 <= count; i += 8) {
+    __m256i hand = _mm256_setr_epi32(
+      hands[i].bits(), hands[i + 1].bits(), hands[i + 2].bits(),
+      hands[i + 3].bits(), hands[i + 4].bits(), hands[i + 5].bits(),
+      hands[i + 6].bits(), hands[i + 7].bits());
+    // One vector per trump suit, one lane per hand
+    __m256i spades = packed_strength_lanes(hand, masks[SPADES]);
+    __m256i hearts = packed_strength_lanes(hand, masks[HEARTS]);
+    __m256i clubs = packed_strength_lanes(hand, masks[CLUBS]);
+    __m256i diamonds = packed_strength_lanes(hand, masks[DIAMONDS]);
+    // Transpose to one 128-bit HandStrength per hand.  Each 128-bit half
+    // is transposed on its own: hands 0 to 3 below, 4 to 7 above.
+    __m256i sh_low = _mm256_unpacklo_epi32(spades, hearts);
+    __m256i sh_high = _mm256_unpackhi_epi32(spades, hearts);
+    __m256i cd_low = _mm256_unpacklo_epi32(clubs, diamonds);
+    __m256i cd_high = _mm256_unpackhi_epi32(clubs, diamonds);
+    __m256i hand0 = _mm256_unpacklo_epi64(sh_low, cd_low);
+    __m256i hand1 = _mm256_unpackhi_epi64(sh_low, cd_low);
+    __m256i hand2 = _mm256_unpacklo_epi64(sh_high, cd_high);
+    __m256i hand3 = _mm256_unpackhi_epi64(sh_high, cd_high);
+    __m256i *dest = reinterpret_cast<__m256i *>(out + i);
+    _mm256_storeu_si256(dest, _mm256_permute2x128_si256(hand0, hand1, 0x20));
+    _mm256_storeu_si256(dest + 1,
+                        _mm256_permute2x128_si256(hand2, hand3, 0x20));
+    _mm256_storeu_si256(dest + 2,
+                        _mm256_permute2x128_si256(hand0, hand1, 0x31));
+    _mm256_storeu_si256(dest + 3,
+                        _mm256_permute2x128_si256(hand2, hand3, 0x31));
+  }
+  evaluate_hands_scalar(hands + i, count - i, out + i);
+}
+
+#endif // HAND_STRENGTH_AVX2
+
+} // namespace
+
+void evaluate_hands(const CardSet *hands, int count, HandStrength *out) {
+#ifdef HAND_STRENGTH_AVX2
+  if (hand_strength_uses_avx2()) {
+    evaluate_hands_avx2(hands, count, out);
+    return;
+  }
+#endif
+  evaluate_hands_scalar(hands, count, out);
+}
+
+void evaluate_hands_scalar(const CardSet *hands, int count,
+                           HandStrength *out) {
+  TrumpMasks masks[4];
+  for (int s = SPADES; s <= DIAMONDS; ++s) {
+    masks[s] = trump_masks(static_cast<Suit>(s));
+  }
+  for (int i = 0; i < count; ++i) {
+    uint32_t packed[4];
+    for (int s = SPADES; s <= DIAMONDS; ++s) {
+      packed[s] = packed_strength(hands[i].bits(), masks[s]);
+    }
+    memcpy(&out[i], packed, sizeof(packed));
+  }
+}
+
+bool hand_strength_uses_avx2() {
+#ifdef HAND_STRENGTH_AVX2
+  static const bool has_avx2 = __builtin_cpu_supports("avx2");
+  return has_avx2;
+#else
+  return false;
+#endif
+}
+
+bool simple_orders_up(const HandStrength &strength, Suit upcard_suit,
+                      bool is_dealer, int round) {
+  if (round == 1) {
+    return strength.by_trump[upcard_suit].faces >= 2;
+  }
+  return strength.by_trump[Suit_next(upcard_suit)].faces >= 1 || is_dealer;
+}
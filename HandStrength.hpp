@@ -0,0 +1,51 @@
+#ifndef HANDSTRENGTH_HPP
+#define HANDSTRENGTH_HPP
+/* HandStrength.hpp
+ *
+ * Counts what a bidder looks at in a hand, for all four possible trump
+ * suits at once, over whole batches of hands.  Hands are CardSet bitboards,
+ * so every count is a mask and a population count; where the processor
+ * has AVX2 eight hands are counted per instruction, and elsewhere the same
+ * counts are made one hand at a time.
+ *
+ * The face card count is the one the Simple strategy bids on (see
+ * BidTable.hpp), so simple_orders_up() here agrees with Simple for hands of
+ * any size.
+ */
+
+#include "Card.hpp"
+#include "CardSet.hpp"
+#include <cstdint>
+
+struct SuitStrength {
+  uint8_t trumps;   // trump cards, left bower included
+  uint8_t bowers;   // right and left bowers, 0 to 2
+  uint8_t faces;    // trump Jacks, Queens, Kings and Aces, left bower included
+  uint8_t off_aces; // Aces of the other three suits
+};
+
+struct HandStrength {
+  SuitStrength by_trump[4]; // indexed by the trump Suit
+};
+
+// REQUIRES: hands and out each hold count elements
+// MODIFIES: out
+// EFFECTS: Sets out[i] to the strength of hands[i], for every i < count,
+//          using AVX2 if this processor has it
+void evaluate_hands(const CardSet *hands, int count, HandStrength *out);
+
+// REQUIRES: hands and out each hold count elements
+// MODIFIES: out
+// EFFECTS: Same as evaluate_hands, one hand at a time
+void evaluate_hands_scalar(const CardSet *hands, int count, HandStrength *out);
+
+// EFFECTS: Returns true if evaluate_hands uses AVX2 on this processor
+bool hand_strength_uses_avx2();
+
+// REQUIRES: round is 1 or 2
+// EFFECTS: Returns true if a Simple player whose hand has strength orders
+//          up in round when the upcard's suit is upcard_suit
+bool simple_orders_up(const HandStrength &strength, Suit upcard_suit,
+                      bool is_dealer, int round);
+
+#endif // HANDSTRENGTH_HPP
@@ -0,0 +1,131 @@
+#include "BidTable.hpp"
+#include "HandRank.hpp"
+#include "HandStrength.hpp"
+#include "unit_test_framework.hpp"
+#include <iostream>
+#include <vector>
+
+using namespace std;
+
+//every hand of size, in rank order
+vector<CardSet> every_hand(int size) {
+    vector<CardSet> hands;
+    CardSet hand = first_hand(size);
+    hands.push_back(hand);
+    while (hands.size() < num_hands(size)) {
+        hand = next_hand(hand);
+        hands.push_back(hand);
+    }
+    return hands;
+}
+
+//counts one Card at a time
+SuitStrength count_cards(CardSet hand, Suit trump) {
+    SuitStrength strength = { 0, 0, 0, 0 };
+    for (Card card : hand) {
+        if (card.get_suit(trump) == trump) {
+            ++strength.trumps;
+            if (card.is_face_or_ace()) {
+                ++strength.faces;
+            }
+        } else if (card.get_rank() == ACE) {
+            ++strength.off_aces;
+        }
+        if (card.is_right_bower(trump) || card.is_left_bower(trump)) {
+            ++strength.bowers;
+        }
+    }
+    return strength;
+}
+
+bool same_strength(const HandStrength &lhs, const HandStrength &rhs) {
+    for (int s = SPADES; s <= DIAMONDS; ++s) {
+        const SuitStrength &l = lhs.by_trump[s];
+        const SuitStrength &r = rhs.by_trump[s];
+        if (l.trumps != r.trumps || l.bowers != r.bowers ||
+            l.faces != r.faces || l.off_aces != r.off_aces) {
+            return false;
+        }
+    }
+    return true;
+}
+
+TEST(test_hand_strength_example) {
+    CardSet hand;
+    hand.insert(Card(JACK, HEARTS));
+    hand.insert(Card(JACK, DIAMONDS));
+    hand.insert(Card(NINE, HEARTS));
+    hand.insert(Card(ACE, SPADES));
+    hand.insert(Card(ACE, HEARTS));
+    HandStrength strength;
+    evaluate_hands(&hand, 1, &strength);
+
+    const SuitStrength &hearts = strength.by_trump[HEARTS];
+    ASSERT_EQUAL(4, hearts.trumps);
+    ASSERT_EQUAL(2, hearts.bowers);
+    ASSERT_EQUAL(3, hearts.faces);
+    ASSERT_EQUAL(1, hearts.off_aces);
+
+    const SuitStrength &clubs = strength.by_trump[CLUBS];
+    ASSERT_EQUAL(0, clubs.trumps);
+    ASSERT_EQUAL(0, clubs.bowers);
+    ASSERT_EQUAL(0, clubs.faces);
+    ASSERT_EQUAL(2, clubs.off_aces);
+}
+
+//both versions agree with counting Cards, for every 5-card hand and for
+//every size of batch up to a few vectors, so the leftovers are covered
+TEST(test_hand_strength_matches_counting) {
+    vector<CardSet> hands = every_hand(5);
+    vector<HandStrength> fast(hands.size());
+    vector<HandStrength> scalar(hands.size());
+    evaluate_hands(hands.data(), hands.size(), fast.data());
+    evaluate_hands_scalar(hands.data(), hands.size(), scalar.data());
+    for (size_t i = 0; i < hands.size(); ++i) {
+        HandStrength counted;
+        for (int s = SPADES; s <= DIAMONDS; ++s) {
+            counted.by_trump[s] = count_cards(hands[i], static_cast<Suit>(s));
+        }
+        ASSERT_TRUE(same_strength(counted, fast[i]));
+        ASSERT_TRUE(same_strength(counted, scalar[i]));
+    }
+    for (int count = 0; count <= 20; ++count) {
+        vector<HandStrength> batch(count);
+        evaluate_hands(hands.data() + 1000, count, batch.data());
+        for (int i = 0; i < count; ++i) {
+            ASSERT_TRUE(same_strength(scalar[1000 + i], batch[i]));
+        }
+    }
+}
+
+TEST(test_hand_strength_six_cards) {
+    vector<CardSet> hands = every_hand(6);
+    vector<HandStrength> fast(hands.size());
+    vector<HandStrength> scalar(hands.size());
+    evaluate_hands(hands.data(), hands.size(), fast.data());
+    evaluate_hands_scalar(hands.data(), hands.size(), scalar.data());
+    for (size_t i = 0; i < hands.size(); ++i) {
+        ASSERT_TRUE(same_strength(scalar[i], fast[i]));
+    }
+}
+
+//bids from the counts are the bids from Simple's table
+TEST(test_hand_strength_simple_bids) {
+    vector<CardSet> hands = every_hand(BID_TABLE_HAND_SIZE);
+    vector<HandStrength> strengths(hands.size());
+    evaluate_hands(hands.data(), hands.size(), strengths.data());
+    for (size_t i = 0; i < hands.size(); ++i) {
+        for (int s = SPADES; s <= DIAMONDS; ++s) {
+            Suit suit = static_cast<Suit>(s);
+            for (int round = 1; round <= 2; ++round) {
+                for (bool dealer : { false, true }) {
+                    ASSERT_EQUAL(
+                        simple_orders_up(hands[i], suit, dealer, round),
+                        simple_orders_up(strengths[i], suit, dealer, round));
+                }
+            }
+        }
+    }
+}
+
+TEST_MAIN()
@@ -0,0 +1,148 @@
+#include "ISMCTS.hpp"
+#include <cassert>
+#include <chrono>
+#include <cmath>
+
+using namespace std;
+
+namespace {
+
+const int NO_NODE = -1;
+
+// Weight of exploration against the average reward in UCB1
+const double EXPLORATION = 0.7;
+
+// Iterations between looks at the clock, under a time limit
+const int CLOCK_INTERVAL = 64;
+
+// EFFECTS: Returns the card of set at position n in index order
+PackedCard nth_index(CardSet set, int n) {
+  uint32_t bits = set.bits();
+  for (int i = 0; i < n; ++i) {
+    bits &= bits - 1;
+  }
+  return PackedCard(__builtin_ctz(bits));
+}
+
+// EFFECTS: Returns true if the hand is over in state
+bool hand_over(const PlayState &state) {
+  return state.hands[state.to_move()].empty();
+}
+
+} // namespace
+
+ISMCTS::ISMCTS(const string &name_in, int iterations_in, int time_limit_ms_in)
+  : MonteCarlo(name_in, DEFAULT_SAMPLES), iterations(iterations_in),
+    time_limit_ms(time_limit_ms_in), pool(POOL_SIZE), used(0) {
+  assert(iterations >= 1 || time_limit_ms >= 1);
+}
+
+int ISMCTS::add_node(int parent, PackedCard move, int mover) {
+  assert(used < POOL_SIZE);
+  int index = used++;
+  pool[index] = Node{move, static_cast<int8_t>(mover), parent, NO_NODE,
+                     NO_NODE, 0, 0, 0};
+  if (parent != NO_NODE) {
+    // Children are found by walking the list, so the order does not matter
+    pool[index].next_sibling = pool[parent].first_child;
+    pool[parent].first_child = index;
+  }
+  return index;
+}
+
+int ISMCTS::select_child(int node, CardSet legal) const {
+  int best = NO_NODE;
+  double best_score = 0;
+  for (int child = pool[node].first_child; child != NO_NODE;
+       child = pool[child].next_sibling) {
+    const Node &candidate = pool[child];
+    if (!(legal.bits() & 1u << candidate.move.index())) {
+      continue;
+    }
+    double score = candidate.reward / candidate.visits +
+      EXPLORATION * sqrt(log(candidate.available) / candidate.visits);
+    if (best == NO_NODE || score > best_score) {
+      best = child;
+      best_score = score;
+    }
+  }
+  assert(best != NO_NODE);
+  return best;
+}
+
+void ISMCTS::iterate(CounterRng &rng) {
+  PlayState state = sample_state(rng);
+  int node = 0;
+  // Walk down while every legal card of this deal already has a node
+  while (!hand_over(state)) {
+    CardSet legal = state.legal_cards();
+    uint32_t untried = legal.bits();
+    for (int child = pool[node].first_child; child != NO_NODE;
+         child = pool[child].next_sibling) {
+      uint32_t bit = 1u << pool[child].move.index();
+      if (untried & bit) {
+        pool[child].available++;
+        untried &= ~bit;
+      }
+    }
+    if (untried) {
+      if (used < POOL_SIZE) {
+        PackedCard move = nth_index(CardSet(untried),
+                                    rng.below(__builtin_popcount(untried)));
+        node = add_node(node, move, state.to_move());
+        pool[node].available++;
+        state.play(move);
+      }
+      break;
+    }
+    node = select_child(node, legal);
+    state.play(pool[node].move);
+  }
+  // Finish the hand at random
+  while (!hand_over(state)) {
+    CardSet legal = state.legal_cards();
+    state.play(nth_index(legal, rng.below(legal.size())));
+  }
+  double total = state.tricks[0] + state.tricks[1];
+  for (; node != 0; node = pool[node].parent) {
+    pool[node].visits++;
+    pool[node].reward += state.tricks[pool[node].mover % 2] / total;
+  }
+  pool[0].visits++;
+}
+
+Card ISMCTS::choose_card(CardSet legal) {
+  Card choice = legal.lowest();
+  if (legal.size() > 1) {
+    CounterRng rng = play_rng();
+    // The pool starts over with just the root
+    used = 0;
+    add_node(NO_NODE, PackedCard(), seat);
+    if (iterations > 0) {
+      for (int i = 0; i < iterations; ++i) {
+        iterate(rng);
+      }
+    } else {
+      auto deadline = chrono::steady_clock::now() +
+                      chrono::milliseconds(time_limit_ms);
+      do {
+        for (int i = 0; i < CLOCK_INTERVAL; ++i) {
+          iterate(rng);
+        }
+      } while (chrono::steady_clock::now() < deadline);
+    }
+    // Play the most visited card, ties to the lowest
+    int most_visits = -1;
+    for (int child = pool[0].first_child; child != NO_NODE;
+         child = pool[child].next_sibling) {
+      Card card = pool[child].move.to_card();
+      int visits = pool[child].visits;
+      if (visits > most_visits || (visits == most_visits && card < choice)) {
+        choice = card;
+        most_visits = visits;
+      }
+    }
+  }
+  hand.erase(choice);
+  return choice;
+}
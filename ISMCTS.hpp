@@ -0,0 +1,76 @@
+#ifndef ISMCTS_HPP
+#define ISMCTS_HPP
+/* ISMCTS.hpp
+ *
+ * Player strategy that plays its cards by Information Set Monte Carlo Tree
+ * Search.  One tree is grown per decision, over what this player can see:
+ * each iteration deals the unseen cards at random (as MonteCarlo does),
+ * walks down the tree choosing among the cards that are legal in that deal
+ * by UCB1, adds one node, finishes the hand with random legal cards, and
+ * credits every node on the path with the share of the tricks its player's
+ * team took.  The card whose node was visited most is played.
+ *
+ * Nodes come from a fixed-size pool that is allocated once, when the
+ * player is made, and handed out again from the start at every decision,
+ * so searching never allocates.  Bidding and the discard are MonteCarlo's.
+ */
+
+#include "MonteCarlo.hpp"
+#include "PackedCard.hpp"
+#include <cstdint>
+#include <string>
+#include <vector>
+
+class ISMCTS : public MonteCarlo {
+public:
+  // Iterations per decision for the "ISMCTS" strategy
+  static const int DEFAULT_ITERATIONS = 1000;
+
+  // Nodes in the pool.  A decision adds at most one node per iteration and
+  // stops adding nodes once the pool is full.
+  static const int POOL_SIZE = 1 << 14;
+
+  //REQUIRES iterations_in >= 1 or time_limit_ms_in >= 1
+  //EFFECTS Initializes a player that runs iterations_in iterations per
+  //  card it plays, or, if iterations_in is 0, as many as it can in
+  //  time_limit_ms_in milliseconds.  Only the iteration budget makes the
+  //  same decisions every time.
+  ISMCTS(const std::string &name_in, int iterations_in, int time_limit_ms_in);
+
+protected:
+  //REQUIRES legal is a non-empty subset of hand
+  //MODIFIES this
+  //EFFECTS Removes and returns the card of legal the search likes best
+  Card choose_card(CardSet legal) override;
+
+private:
+  struct Node {
+    PackedCard move; // card played to reach this node
+    int8_t mover;    // seat that played it
+    int32_t parent;
+    int32_t first_child;
+    int32_t next_sibling;
+    int32_t visits;
+    int32_t available; // times the move was legal when the parent was visited
+    float reward;      // total share of the tricks won by the mover's team
+  };
+
+  int iterations;
+  int time_limit_ms;
+  std::vector<Node> pool;
+  int used;
+
+  //MODIFIES this
+  //EFFECTS Returns a new node for move by mover, as the last child of parent
+  int add_node(int parent, PackedCard move, int mover);
+
+  //REQUIRES at least one child of node is in legal
+  //EFFECTS Returns the child of node in legal with the best UCB1 score
+  int select_child(int node, CardSet legal) const;
+
+  //MODIFIES rng, this
+  //EFFECTS Runs one iteration of the search on a sampled deal
+  void iterate(CounterRng &rng);
+};
+
+#endif // ISMCTS_HPP
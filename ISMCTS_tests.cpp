@@ -0,0 +1,120 @@
+#include "DoubleDummy.hpp"
+#include "Game.hpp"
+#include "Player.hpp"
+#include "Tournament.hpp"
+#include "unit_test_framework.hpp"
+#include <array>
+#include <iostream>
+#include <string>
+#include <vector>
+
+using namespace std;
+
+const vector<string> NAMES = { "Adi", "Barbara", "Chi-Chih", "Dabbala" };
+const ShuffleSetting RANDOM = { ShuffleSetting::RANDOM, 280, 0 };
+
+//strategy names the factory accepts
+TEST(test_ismcts_strategy_names) {
+    ASSERT_TRUE(Player_strategy_exists("ISMCTS"));
+    ASSERT_TRUE(Player_strategy_exists("ISMCTS:500"));
+    ASSERT_TRUE(Player_strategy_exists("ISMCTS:20ms"));
+    ASSERT_FALSE(Player_strategy_exists("ISMCTS:"));
+    ASSERT_FALSE(Player_strategy_exists("ISMCTS:ms"));
+    ASSERT_FALSE(Player_strategy_exists("ISMCTS:0"));
+    ASSERT_FALSE(Player_strategy_exists("ISMCTS:5s"));
+
+    Player *player = Player_factory("Adi", "ISMCTS:20ms");
+    ASSERT_EQUAL("Adi", player->get_name());
+    delete player;
+}
+
+//deals the hand recorded in log the way Game does, then checks that
+//every card played followed suit when it had to
+bool plays_are_legal(const HandLog &hand) {
+    array<CardSet, 4> hands;
+    const int packets[] = { 3, 2, 3, 2, 2, 3, 2, 3 };
+    int position = 0;
+    for (int packet = 0; packet < 8; ++packet) {
+        int seat = (hand.dealer + 1 + packet) % 4;
+        for (int i = 0; i < packets[packet]; ++i) {
+            hands[seat].insert(hand.pack[position++].to_card());
+        }
+    }
+    if (hand.passes < 4) {
+        hands[hand.dealer].insert(hand.pack[position].to_card());
+        hands[hand.dealer].erase(PackedCard(hand.discard).to_card());
+    }
+    PlayState state(hands, hand.trump, (hand.dealer + 1) % 4);
+    for (PackedCard card : hand.plays) {
+        if (!state.legal_cards().contains(card.to_card())) {
+            return false;
+        }
+        state.play(card);
+    }
+    return true;
+}
+
+//every card an ISMCTS player plays is legal, with an iteration budget
+//and with a time budget
+TEST(test_ismcts_plays_legal_cards) {
+    const string strategies[] = { "ISMCTS:50", "ISMCTS:1ms" };
+    for (const string &strategy : strategies) {
+        vector<Player*> players;
+        for (int seat = 0; seat < 4; ++seat) {
+            players.push_back(Player_factory(NAMES[seat], strategy));
+        }
+        NullSink out;
+        Game game({ Pack(), RANDOM, 5 }, players, out);
+        GameLog log;
+        game.set_log(&log);
+        game.play();
+        for (int i = 0; i < log.num_hands(); ++i) {
+            ASSERT_TRUE(plays_are_legal(log.get_hand(i)));
+        }
+        for (Player *player : players) {
+            delete player;
+        }
+    }
+}
+
+//a search longer than the pool stops growing the tree and still decides
+TEST(test_ismcts_full_pool) {
+    Player *player = Player_factory("Adi", "ISMCTS:20000");
+    player->add_card(Card(NINE, HEARTS));
+    player->add_card(Card(JACK, SPADES));
+    player->add_card(Card(ACE, DIAMONDS));
+    player->add_card(Card(KING, CLUBS));
+    player->add_card(Card(TEN, SPADES));
+    Card upcard(NINE, CLUBS);
+    player->start_hand(0, 3, upcard);
+    player->trump_made(1, SPADES, 2);
+    Card led = player->lead_card(SPADES);
+    ASSERT_TRUE(led == Card(NINE, HEARTS) || led == Card(JACK, SPADES) ||
+                led == Card(ACE, DIAMONDS) || led == Card(KING, CLUBS) ||
+                led == Card(TEN, SPADES));
+    delete player;
+}
+
+//with an iteration budget, decisions do not depend on the thread
+TEST(test_ismcts_threads_agree) {
+    vector<string> strategies = { "ISMCTS:50", "Simple",
+                                  "ISMCTS:50", "Simple" };
+    Tournament tournament({ Pack(), RANDOM, 5 }, NAMES, strategies);
+    GameTotals one = tournament.run(10, 1);
+    GameTotals many = tournament.run(10, 3);
+    ASSERT_EQUAL(one.get_wins(0), many.get_wins(0));
+    ASSERT_EQUAL(one.get_euchres(), many.get_euchres());
+    ASSERT_EQUAL(one.get_marches(), many.get_marches());
+    ASSERT_EQUAL(one.get_average_hands(), many.get_average_hands());
+}
+
+//searching beats counting face cards
+TEST(test_ismcts_beats_simple) {
+    vector<string> strategies = { "ISMCTS:100", "Simple",
+                                  "ISMCTS:100", "Simple" };
+    Tournament tournament({ Pack(), RANDOM, 10 }, NAMES, strategies);
+    GameTotals totals = tournament.run(20, 2);
+    ASSERT_TRUE(totals.get_wins(0) >= 15);
+}
+
+TEST_MAIN()
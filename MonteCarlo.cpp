@@ -0,0 +1,320 @@
+#include "MonteCarlo.hpp"
+#include <cassert>
+
+using namespace std;
+
+namespace {
+
+const CardSet ALL_CARDS((1u << CardSet::NUM_CARDS) - 1);
+
+// Tries at dealing around the suits players have shown out of before
+// giving up on them.  Only a few unlikely hands ever need more than one.
+const int MAX_DEAL_TRIES = 20;
+
+// Decisions that can be made with the same cards seen
+const int DISCARD_DECISION = 3;
+const int PLAY_DECISION = 4;
+
+// EFFECTS: Returns the points the makers score for taking tricks
+int points_for_makers(int tricks) {
+  if (tricks == 5) {
+    return 2;
+  }
+  return tricks >= 3 ? 1 : -2;
+}
+
+// EFFECTS: Returns the tricks of the remaining tricks that seat's team
+//          takes, given those taken by players 0 and 2
+int tricks_for_seat(int seat, int team0_tricks, int total) {
+  return seat % 2 == 0 ? team0_tricks : total - team0_tricks;
+}
+
+// What a sampled deal of the unseen cards must agree with
+struct DealRules {
+  int need[4];       // cards each seat is dealt
+  unsigned voids[4]; // bit s is set if the seat has shown out of suit s
+  Suit trump;        // which decides the suit of the left bower
+};
+
+// EFFECTS: Returns rules where every seat but seat needs five cards and no
+//          seat has shown out of a suit
+DealRules full_hands_except(int seat, Suit trump) {
+  DealRules rules = { {5, 5, 5, 5}, {0, 0, 0, 0}, trump };
+  rules.need[seat] = 0;
+  return rules;
+}
+
+// MODIFIES: rng, hands
+// EFFECTS: Deals every card of pool to a seat s with rules.need[s] > 0 that
+//          has not shown out of the card's suit, or leaves it undealt, so
+//          that each seat gets exactly rules.need[s] cards.  Each card goes
+//          to a seat with probability proportional to the cards the seat
+//          still needs, which with no voids makes every deal equally
+//          likely.  Returns false if the voids made that impossible.
+bool deal_cards(CounterRng &rng, CardSet pool, const DealRules &rules,
+                array<CardSet, 4> &hands) {
+  const unsigned *voids = rules.voids;
+  Suit trump = rules.trump;
+  int need[4];
+  int spare = pool.size();
+  for (int s = 0; s < 4; ++s) {
+    need[s] = rules.need[s];
+    spare -= need[s];
+  }
+  assert(spare >= 0);
+  for (uint32_t bits = pool.bits(); bits; bits &= bits - 1) {
+    int index = __builtin_ctz(bits);
+    unsigned suit_bit = 1u << PackedCard(index).get_suit(trump);
+    int weights[5];
+    int total = spare;
+    for (int s = 0; s < 4; ++s) {
+      weights[s] = (voids[s] & suit_bit) ? 0 : need[s];
+      total += weights[s];
+    }
+    weights[4] = spare;
+    if (total == 0) {
+      return false;
+    }
+    int pick = rng.below(total);
+    int s = 0;
+    while (pick >= weights[s]) {
+      pick -= weights[s++];
+    }
+    if (s == 4) {
+      --spare;
+    } else {
+      hands[s] = CardSet(hands[s].bits() | 1u << index);
+      --need[s];
+    }
+  }
+  return true;
+}
+
+// EFFECTS: Returns hand without its lowest card in trump order, which is
+//          how the strategy expects a dealer to discard
+CardSet without_lowest(CardSet hand, Suit trump) {
+  hand.erase(hand.lowest(trump));
+  return hand;
+}
+
+} // namespace
+
+MonteCarlo::MonteCarlo(const string &name_in, int samples_in)
+  : seat(0), dealer(0), upcard(), trump(SPADES), upcard_taken(false),
+    cards_played{0, 0, 0, 0}, voids{0, 0, 0, 0}, trick_leader(0),
+    trick_size(0), trick(), name(name_in), samples(samples_in) {
+  assert(samples >= 1);
+}
+
+const string & MonteCarlo::get_name() const {
+  return name;
+}
+
+void MonteCarlo::add_card(const Card &c) {
+  hand.insert(c);
+}
+
+void MonteCarlo::start_hand(int seat_in, int dealer_in, const Card &upcard_in) {
+  seat = seat_in;
+  dealer = dealer_in;
+  upcard = upcard_in;
+  upcard_taken = false;
+  discarded = CardSet();
+  played = CardSet();
+  for (int s = 0; s < 4; ++s) {
+    cards_played[s] = 0;
+    voids[s] = 0;
+  }
+  trick_size = 0;
+}
+
+void MonteCarlo::trump_made(int maker, Suit trump_in, int round) {
+  trump = trump_in;
+  upcard_taken = round == 1;
+}
+
+void MonteCarlo::card_played(int player, const Card &card) {
+  PackedCard packed(card);
+  if (trick_size == 0) {
+    trick_leader = player;
+  } else {
+    Suit led_suit = trick[0].get_suit(trump);
+    if (packed.get_suit(trump) != led_suit) {
+      voids[player] |= 1u << led_suit;
+    }
+  }
+  trick[trick_size] = packed;
+  trick_size = (trick_size + 1) % 4;
+  played.insert(card);
+  cards_played[player]++;
+}
+
+CounterRng MonteCarlo::decision_rng(int decision) const {
+  uint64_t seen = hand.bits() | static_cast<uint64_t>(played.bits()) << 24 |
+                  static_cast<uint64_t>(PackedCard(upcard).index()) << 48;
+  return CounterRng(seen, seat | dealer << 2 | decision << 4);
+}
+
+bool MonteCarlo::make_trump(const Card &upcard_in, bool is_dealer,
+                            int round, Suit &order_up_suit) const {
+  assert(is_dealer == (seat == dealer));
+  CounterRng rng = decision_rng(round);
+  Suit best_suit = Suit_next(upcard_in.get_suit());
+  double best_value = 0;
+  bool found = false;
+  for (int s = SPADES; s <= DIAMONDS; ++s) {
+    Suit suit = static_cast<Suit>(s);
+    // Round 1 is for the upcard's suit, round 2 for any other
+    if ((round == 1) != (suit == upcard_in.get_suit())) {
+      continue;
+    }
+    // Without a single trump there is nothing worth searching, unless the
+    // upcard is coming into this hand
+    if (hand.count(suit, suit) == 0 && !(round == 1 && is_dealer)) {
+      continue;
+    }
+    double value = order_value(suit, round, rng);
+    if (!found || value > best_value) {
+      best_suit = suit;
+      best_value = value;
+      found = true;
+    }
+  }
+  // Passing scores nothing, and the dealer may not pass in round 2
+  if (best_value > 0 || (is_dealer && round == 2)) {
+    order_up_suit = best_suit;
+    return true;
+  }
+  return false;
+}
+
+double MonteCarlo::order_value(Suit order_suit, int round,
+                               CounterRng &rng) const {
+  CardSet pool = ALL_CARDS - hand;
+  pool.erase(upcard);
+  const DealRules rules = full_hands_except(seat, order_suit);
+  int leader = (dealer + 1) % 4;
+  int total = 0;
+  for (int i = 0; i < samples; ++i) {
+    array<CardSet, 4> hands;
+    hands[seat] = hand;
+    deal_cards(rng, pool, rules, hands);
+    if (round == 1) {
+      CardSet with_upcard = hands[dealer];
+      with_upcard.insert(upcard);
+      hands[dealer] = without_lowest(with_upcard, order_suit);
+    }
+    int tricks = solver.solve(hands, order_suit, leader);
+    total += points_for_makers(tricks_for_seat(seat, tricks, 5));
+  }
+  return static_cast<double>(total) / samples;
+}
+
+void MonteCarlo::add_and_discard(const Card &upcard_in) {
+  CardSet options = hand;
+  options.insert(upcard_in);
+  Suit order_suit = upcard_in.get_suit();
+  CardSet pool = ALL_CARDS - options;
+  const DealRules rules = full_hands_except(seat, order_suit);
+  int leader = (dealer + 1) % 4;
+  CounterRng rng = decision_rng(DISCARD_DECISION);
+  int totals[CardSet::NUM_CARDS] = {};
+  for (int i = 0; i < samples; ++i) {
+    array<CardSet, 4> hands;
+    deal_cards(rng, pool, rules, hands);
+    for (Card card : options) {
+      hands[seat] = options;
+      hands[seat].erase(card);
+      int tricks = solver.solve(hands, order_suit, leader);
+      totals[CardSet::index_of(card)] += tricks_for_seat(seat, tricks, 5);
+    }
+  }
+  // Ties go to the lowest card
+  Card discard = options.lowest();
+  for (Card card : options) {
+    if (totals[CardSet::index_of(card)] > totals[CardSet::index_of(discard)]) {
+      discard = card;
+    }
+  }
+  options.erase(discard);
+  hand = options;
+  discarded.insert(discard);
+}
+
+array<CardSet, 4> MonteCarlo::sample_play(CounterRng &rng) const {
+  CardSet pool = ALL_CARDS - hand - played - discarded;
+  pool.erase(upcard);
+  DealRules rules;
+  rules.trump = trump;
+  for (int s = 0; s < 4; ++s) {
+    rules.need[s] = s == seat ? 0 : 5 - cards_played[s];
+    rules.voids[s] = voids[s];
+  }
+  array<CardSet, 4> fixed;
+  fixed[seat] = hand;
+  // Only the dealer can hold an upcard that was picked up
+  if (upcard_taken && dealer != seat && !played.contains(upcard)) {
+    fixed[dealer].insert(upcard);
+    rules.need[dealer]--;
+  }
+  array<CardSet, 4> hands = fixed;
+  for (int tries = 0; tries < MAX_DEAL_TRIES; ++tries) {
+    if (deal_cards(rng, pool, rules, hands)) {
+      return hands;
+    }
+    hands = fixed;
+  }
+  // Give up on the voids rather than on the deal
+  for (unsigned &void_suits : rules.voids) {
+    void_suits = 0;
+  }
+  deal_cards(rng, pool, rules, hands);
+  return hands;
+}
+
+CounterRng MonteCarlo::play_rng() const {
+  return decision_rng(PLAY_DECISION + trick_size);
+}
+
+PlayState MonteCarlo::sample_state(CounterRng &rng) const {
+  PlayState state(sample_play(rng), trump, trick_leader);
+  state.num_played = trick_size;
+  state.trick = trick;
+  return state;
+}
+
+Card MonteCarlo::choose_card(CardSet legal) {
+  Card choice = legal.lowest();
+  if (legal.size() > 1) {
+    CounterRng rng = play_rng();
+    int totals[CardSet::NUM_CARDS] = {};
+    int values[CardSet::NUM_CARDS];
+    for (int i = 0; i < samples; ++i) {
+      solver.solve_moves(sample_state(rng), values);
+      for (Card card : legal) {
+        int index = CardSet::index_of(card);
+        totals[index] += seat % 2 == 0 ? values[index] : -values[index];
+      }
+    }
+    // Ties go to the lowest card
+    for (Card card : legal) {
+      if (totals[CardSet::index_of(card)] > totals[CardSet::index_of(choice)]) {
+        choice = card;
+      }
+    }
+  }
+  hand.erase(choice);
+  return choice;
+}
+
+Card MonteCarlo::lead_card(Suit trump_in) {
+  assert(trump_in == trump && trick_size == 0);
+  trick_leader = seat;
+  return choose_card(hand);
+}
+
+Card MonteCarlo::play_card(const Card &led_card, Suit trump_in) {
+  assert(trump_in == trump && trick_size > 0);
+  CardSet following = hand & CardSet::of_suit(led_card.get_suit(trump), trump);
+  return choose_card(following.empty() ? hand : following);
+}
@@ -0,0 +1,111 @@
+#ifndef MONTECARLO_HPP
+#define MONTECARLO_HPP
+/* MonteCarlo.hpp
+ *
+ * Player strategy that decides by perfect-information Monte Carlo: at each
+ * decision it deals the cards it has not seen to the other seats a number
+ * of times, consistent with everything seen so far in the hand, solves each
+ * deal exactly with DoubleDummy, and takes the action that does best on
+ * average over the deals.
+ *
+ * Sampled deals respect the cards already played, the upcard the dealer
+ * picked up, and every suit a player has shown out of.  The random numbers
+ * for a decision are drawn from a stream keyed by what the player has seen,
+ * so the same situation always gets the same decision, whichever thread of
+ * a Tournament plays it.
+ */
+
+#include "CardSet.hpp"
+#include "DoubleDummy.hpp"
+#include "PackedCard.hpp"
+#include "Player.hpp"
+#include "Rng.hpp"
+#include <array>
+#include <string>
+
+class MonteCarlo : public Player {
+public:
+  // Deals sampled per decision for the "MonteCarlo" strategy
+  static const int DEFAULT_SAMPLES = 8;
+
+  //REQUIRES samples_in >= 1
+  //EFFECTS Initializes a player that samples samples_in deals per decision
+  MonteCarlo(const std::string &name_in, int samples_in);
+
+  const std::string & get_name() const override;
+  void add_card(const Card &c) override;
+
+  //REQUIRES start_hand has been called for this hand
+  bool make_trump(const Card &upcard, bool is_dealer,
+                  int round, Suit &order_up_suit) const override;
+
+  //REQUIRES start_hand has been called for this hand
+  void add_and_discard(const Card &upcard) override;
+
+  //REQUIRES trump_made has been called for this hand
+  Card lead_card(Suit trump) override;
+
+  //REQUIRES trump_made has been called for this hand
+  Card play_card(const Card &led_card, Suit trump) override;
+
+  void start_hand(int seat, int dealer, const Card &upcard) override;
+  void trump_made(int maker, Suit trump, int round) override;
+  void card_played(int seat, const Card &card) override;
+
+protected:
+  CardSet hand;
+
+  // What this player has seen of the current hand
+  int seat;
+  int dealer;
+  Card upcard;
+  Suit trump;
+  bool upcard_taken;   // ordered up in round 1, so the dealer picked it up
+  CardSet discarded;   // this player's own discard, as the dealer
+  CardSet played;      // every card played so far, including the trick
+  int cards_played[4]; // number of cards each seat has played
+  unsigned voids[4];   // bit s is set if the seat has shown out of suit s
+  int trick_leader;
+  int trick_size;
+  std::array<PackedCard, 4> trick;
+
+  //EFFECTS Returns the random stream for the next card this player plays,
+  //  keyed by everything the player has seen
+  CounterRng play_rng() const;
+
+  //MODIFIES rng
+  //EFFECTS Returns the current position of the hand with the cards this
+  //  player has not seen dealt at random, agreeing with everything this
+  //  player has seen
+  PlayState sample_state(CounterRng &rng) const;
+
+  //REQUIRES legal is a non-empty subset of hand
+  //MODIFIES this
+  //EFFECTS Removes and returns the card of legal that takes the most tricks
+  //  for this player's team on average over sampled deals
+  virtual Card choose_card(CardSet legal);
+
+private:
+  std::string name;
+  int samples;
+
+  // The transposition table is worth keeping between decisions
+  mutable DoubleDummy solver;
+
+  //EFFECTS Returns the random stream for a decision, keyed by everything
+  //  the player has seen and by decision, which tells apart the different
+  //  decisions that could be made with the same cards seen
+  CounterRng decision_rng(int decision) const;
+
+  //MODIFIES rng
+  //EFFECTS Returns the average points this player's team scores over
+  //  sampled deals if it orders up order_suit in round
+  double order_value(Suit order_suit, int round, CounterRng &rng) const;
+
+  //MODIFIES rng
+  //EFFECTS Returns a deal of the rest of the hand, from the current trick
+  //  on, that agrees with everything this player has seen
+  std::array<CardSet, 4> sample_play(CounterRng &rng) const;
+};
+
+#endif // MONTECARLO_HPP
@@ -0,0 +1,178 @@
+#include "DoubleDummy.hpp"
+#include "Game.hpp"
+#include "Player.hpp"
+#include "Tournament.hpp"
+#include "unit_test_framework.hpp"
+#include <array>
+#include <iostream>
+#include <string>
+#include <vector>
+
+using namespace std;
+
+const vector<string> NAMES = { "Adi", "Barbara", "Chi-Chih", "Dabbala" };
+const ShuffleSetting RANDOM = { ShuffleSetting::RANDOM, 280, 0 };
+
+//strategy names the factory accepts
+TEST(test_monte_carlo_strategy_names) {
+    ASSERT_TRUE(Player_strategy_exists("MonteCarlo"));
+    ASSERT_TRUE(Player_strategy_exists("MonteCarlo:1"));
+    ASSERT_TRUE(Player_strategy_exists("MonteCarlo:64"));
+    ASSERT_TRUE(Player_strategy_exists("Simple"));
+    ASSERT_FALSE(Player_strategy_exists("MonteCarlo:"));
+    ASSERT_FALSE(Player_strategy_exists("MonteCarlo:0"));
+    ASSERT_FALSE(Player_strategy_exists("MonteCarlo:8x"));
+    ASSERT_FALSE(Player_strategy_exists("Monte"));
+
+    Player *player = Player_factory("Adi", "MonteCarlo:3");
+    ASSERT_EQUAL("Adi", player->get_name());
+    delete player;
+}
+
+//five top trumps always order up, and a hand without trump passes
+TEST(test_monte_carlo_make_trump) {
+    Player *strong = Player_factory("Adi", "MonteCarlo:4");
+    strong->add_card(Card(JACK, SPADES));
+    strong->add_card(Card(JACK, CLUBS));
+    strong->add_card(Card(ACE, SPADES));
+    strong->add_card(Card(KING, SPADES));
+    strong->add_card(Card(QUEEN, SPADES));
+    Card upcard(NINE, SPADES);
+    strong->start_hand(0, 3, upcard);
+    Suit order_up_suit = HEARTS;
+    ASSERT_TRUE(strong->make_trump(upcard, false, 1, order_up_suit));
+    ASSERT_EQUAL(SPADES, order_up_suit);
+    delete strong;
+
+    Player *weak = Player_factory("Barbara", "MonteCarlo:4");
+    weak->add_card(Card(NINE, HEARTS));
+    weak->add_card(Card(TEN, HEARTS));
+    weak->add_card(Card(NINE, DIAMONDS));
+    weak->add_card(Card(TEN, DIAMONDS));
+    weak->add_card(Card(QUEEN, HEARTS));
+    weak->start_hand(0, 3, upcard);
+    order_up_suit = HEARTS;
+    ASSERT_FALSE(weak->make_trump(upcard, false, 1, order_up_suit));
+    ASSERT_EQUAL(HEARTS, order_up_suit);
+    delete weak;
+}
+
+//the dealer may not pass in round 2, or name the upcard's suit
+TEST(test_monte_carlo_dealer_round_two) {
+    Player *dealer = Player_factory("Adi", "MonteCarlo:4");
+    dealer->add_card(Card(NINE, HEARTS));
+    dealer->add_card(Card(TEN, HEARTS));
+    dealer->add_card(Card(NINE, DIAMONDS));
+    dealer->add_card(Card(TEN, DIAMONDS));
+    dealer->add_card(Card(QUEEN, CLUBS));
+    Card upcard(ACE, SPADES);
+    dealer->start_hand(2, 2, upcard);
+    Suit order_up_suit = SPADES;
+    ASSERT_TRUE(dealer->make_trump(upcard, true, 2, order_up_suit));
+    ASSERT_NOT_EQUAL(SPADES, order_up_suit);
+    delete dealer;
+}
+
+//the dealer keeps the upcard and throws away an off-suit Nine
+TEST(test_monte_carlo_discard) {
+    Player *dealer = Player_factory("Adi", "MonteCarlo:4");
+    dealer->add_card(Card(JACK, HEARTS));
+    dealer->add_card(Card(ACE, HEARTS));
+    dealer->add_card(Card(KING, HEARTS));
+    dealer->add_card(Card(ACE, CLUBS));
+    dealer->add_card(Card(NINE, SPADES));
+    Card upcard(QUEEN, HEARTS);
+    dealer->start_hand(0, 0, upcard);
+    dealer->trump_made(1, HEARTS, 1);
+    dealer->add_and_discard(upcard);
+    // Lead out the whole hand, the Nine never comes up
+    const Card others[] = {
+        Card(TEN, SPADES), Card(JACK, SPADES), Card(QUEEN, SPADES),
+        Card(KING, SPADES), Card(ACE, SPADES), Card(NINE, DIAMONDS),
+        Card(TEN, DIAMONDS), Card(QUEEN, DIAMONDS), Card(KING, DIAMONDS),
+        Card(ACE, DIAMONDS), Card(NINE, CLUBS), Card(TEN, CLUBS),
+        Card(QUEEN, CLUBS), Card(KING, CLUBS), Card(NINE, HEARTS),
+    };
+    for (int trick = 0; trick < 5; ++trick) {
+        Card card = dealer->lead_card(HEARTS);
+        ASSERT_NOT_EQUAL(Card(NINE, SPADES), card);
+        dealer->card_played(0, card);
+        for (int seat = 1; seat < 4; ++seat) {
+            dealer->card_played(seat, others[trick * 3 + seat - 1]);
+        }
+    }
+    delete dealer;
+}
+
+//deals the hand recorded in log the way Game does, then checks that
+//every card played followed suit when it had to
+bool plays_are_legal(const HandLog &hand) {
+    array<CardSet, 4> hands;
+    const int packets[] = { 3, 2, 3, 2, 2, 3, 2, 3 };
+    int position = 0;
+    for (int packet = 0; packet < 8; ++packet) {
+        int seat = (hand.dealer + 1 + packet) % 4;
+        for (int i = 0; i < packets[packet]; ++i) {
+            hands[seat].insert(hand.pack[position++].to_card());
+        }
+    }
+    if (hand.passes < 4) {
+        hands[hand.dealer].insert(hand.pack[position].to_card());
+        hands[hand.dealer].erase(PackedCard(hand.discard).to_card());
+    }
+    PlayState state(hands, hand.trump, (hand.dealer + 1) % 4);
+    for (PackedCard card : hand.plays) {
+        if (!state.legal_cards().contains(card.to_card())) {
+            return false;
+        }
+        state.play(card);
+    }
+    return true;
+}
+
+//every card a MonteCarlo player plays is legal
+TEST(test_monte_carlo_plays_legal_cards) {
+    vector<Player*> players;
+    for (int seat = 0; seat < 4; ++seat) {
+        players.push_back(Player_factory(NAMES[seat], "MonteCarlo:2"));
+    }
+    NullSink out;
+    for (int stream = 0; stream < 3; ++stream) {
+        ShuffleSetting shuffle = RANDOM;
+        shuffle.stream = stream;
+        Game game({ Pack(), shuffle, 10 }, players, out);
+        GameLog log;
+        game.set_log(&log);
+        game.play();
+        for (int i = 0; i < log.num_hands(); ++i) {
+            ASSERT_TRUE(plays_are_legal(log.get_hand(i)));
+        }
+    }
+    for (Player *player : players) {
+        delete player;
+    }
+}
+
+//decisions depend only on what was seen, not on which thread saw it
+TEST(test_monte_carlo_threads_agree) {
+    vector<string> strategies = { "MonteCarlo:2", "Simple",
+                                  "MonteCarlo:2", "Simple" };
+    Tournament tournament({ Pack(), RANDOM, 5 }, NAMES, strategies);
+    GameTotals one = tournament.run(12, 1);
+    GameTotals many = tournament.run(12, 3);
+    ASSERT_EQUAL(one.get_wins(0), many.get_wins(0));
+    ASSERT_EQUAL(one.get_euchres(), many.get_euchres());
+    ASSERT_EQUAL(one.get_marches(), many.get_marches());
+    ASSERT_EQUAL(one.get_average_hands(), many.get_average_hands());
+}
+
+//sampling beats counting face cards
+TEST(test_monte_carlo_beats_simple) {
+    vector<string> strategies = { "MonteCarlo:4", "Simple",
+                                  "MonteCarlo:4", "Simple" };
+    Tournament tournament({ Pack(), RANDOM, 10 }, NAMES, strategies);
+    GameTotals totals = tournament.run(20, 2);
+    ASSERT_TRUE(totals.get_wins(0) >= 15);
+}
+
+TEST_MAIN()
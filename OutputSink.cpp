@@ -0,0 +1,92 @@
+#include "OutputSink.hpp"
+#include <cassert>
+#include <charconv>
+#include <sstream>
+
+using namespace std;
+
+namespace {
+
+// Size of the stdio buffer given to a FileSink
+const size_t FILE_BUFFER_SIZE = 1 << 16;
+
+} // namespace
+
+OutputSink & operator<<(OutputSink &sink, int value) {
+  char digits[16];
+  to_chars_result converted = to_chars(digits, digits + sizeof(digits), value);
+  assert(converted.ec == errc());
+  sink.write(digits, converted.ptr - digits);
+  return sink;
+}
+
+OutputSink & operator<<(OutputSink &sink, const Card &card) {
+  if (card.get_rank() >= NINE) {
+    return sink << PackedCard(card).name();
+  }
+  // Not a euchre card, so there is no precomputed name
+  ostringstream name;
+  name << card;
+  return sink << name.str();
+}
+
+// StdoutSink implementation
+StdoutSink::StdoutSink(bool interactive)
+  : OutputSink(interactive ? 0 : BUFFER_SIZE) {}
+
+void StdoutSink::write_through(const char *data, size_t size) {
+  fwrite(data, 1, size, stdout);
+}
+
+void StdoutSink::sync() {
+  fflush(stdout);
+}
+
+StdoutSink::~StdoutSink() {
+  flush();
+}
+
+// FileSink implementation
+FileSink::FileSink(const string &filename)
+  : file(fopen(filename.c_str(), "w")) {
+  if (file) {
+    setvbuf(file, nullptr, _IOFBF, FILE_BUFFER_SIZE);
+  }
+}
+
+bool FileSink::is_open() const {
+  return file != nullptr;
+}
+
+void FileSink::write_through(const char *data, size_t size) {
+  assert(file);
+  fwrite(data, 1, size, file);
+}
+
+void FileSink::sync() {
+  if (file) {
+    fflush(file);
+  }
+}
+
+FileSink::~FileSink() {
+  if (file) {
+    flush_buffer();
+    fclose(file);
+  }
+}
+
+// MemorySink implementation
+void MemorySink::write_through(const char *data, size_t size) {
+  text.append(data, size);
+}
+
+const string & MemorySink::str() {
+  flush_buffer();
+  return text;
+}
+
+void MemorySink::clear() {
+  flush_buffer();
+  text.clear();
+}
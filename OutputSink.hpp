@@ -0,0 +1,184 @@
+#ifndef OUTPUTSINK_HPP
+#define OUTPUTSINK_HPP
+/* OutputSink.hpp
+ *
+ * Destinations for game transcripts.  A Game writes every line through an
+ * OutputSink instead of a std::ostream: cards and suits are copied from the
+ * precomputed name tables in PackedCard.hpp, numbers are formatted with
+ * std::to_chars, and lines end in '\n' rather than std::endl, so nothing is
+ * flushed until the sink decides to.
+ *
+ * StdoutSink  - standard output, through the C stdio buffer
+ * FileSink    - a file, with a large stdio buffer
+ * NullSink    - discards everything, for batch games
+ * MemorySink  - keeps everything in a string, for tests and replays
+ */
+
+#include "Card.hpp"
+#include "PackedCard.hpp"
+#include <cstddef>
+#include <cstdio>
+#include <cstring>
+#include <string>
+#include <string_view>
+
+class OutputSink {
+public:
+  //EFFECTS Writes size bytes starting at data.  Small writes are copied
+  //  into a buffer that is handed to the destination when it fills up, so
+  //  most writes are a single memcpy.
+  void write(const char *data, std::size_t size) {
+    if (size > capacity - used) {
+      flush_buffer();
+      if (size > capacity) {
+        write_through(data, size);
+        return;
+      }
+    }
+    std::memcpy(buffer + used, data, size);
+    used += size;
+  }
+
+  //EFFECTS Sends anything buffered to its destination
+  void flush() {
+    flush_buffer();
+    sync();
+  }
+
+  virtual ~OutputSink() {}
+
+protected:
+  // Size of the buffer in front of every sink
+  static const std::size_t BUFFER_SIZE = 1 << 12;
+
+  //REQUIRES capacity_in <= BUFFER_SIZE
+  //EFFECTS Initializes a sink that buffers up to capacity_in bytes.  With a
+  //  capacity of 0 every write goes straight to the destination.
+  explicit OutputSink(std::size_t capacity_in = BUFFER_SIZE)
+    : capacity(capacity_in), used(0) {}
+
+  //EFFECTS Sends size bytes starting at data to the destination
+  virtual void write_through(const char *data, std::size_t size) = 0;
+
+  //EFFECTS Flushes any buffering done by the destination itself
+  virtual void sync() {}
+
+  //EFFECTS Sends the buffer to the destination and empties it.  Every
+  //  derived destructor must call this, since write_through cannot be
+  //  called from ~OutputSink.
+  void flush_buffer() {
+    if (used > 0) {
+      write_through(buffer, used);
+      used = 0;
+    }
+  }
+
+private:
+  std::size_t capacity;
+  std::size_t used;
+  char buffer[BUFFER_SIZE];
+
+  OutputSink(const OutputSink &) = delete;
+  OutputSink & operator=(const OutputSink &) = delete;
+};
+
+//EFFECTS Writes text to sink
+inline OutputSink & operator<<(OutputSink &sink, std::string_view text) {
+  sink.write(text.data(), text.size());
+  return sink;
+}
+
+//EFFECTS Writes text to sink
+inline OutputSink & operator<<(OutputSink &sink, const char *text) {
+  return sink << std::string_view(text);
+}
+
+//EFFECTS Writes text to sink
+inline OutputSink & operator<<(OutputSink &sink, const std::string &text) {
+  sink.write(text.data(), text.size());
+  return sink;
+}
+
+//EFFECTS Writes c to sink
+inline OutputSink & operator<<(OutputSink &sink, char c) {
+  sink.write(&c, 1);
+  return sink;
+}
+
+//EFFECTS Writes value to sink in decimal
+OutputSink & operator<<(OutputSink &sink, int value);
+
+//EFFECTS Writes the name of suit to sink, for example "Spades"
+inline OutputSink & operator<<(OutputSink &sink, Suit suit) {
+  return sink << PackedCard::suit_name(suit);
+}
+
+//EFFECTS Writes card to sink, for example "Nine of Spades"
+inline OutputSink & operator<<(OutputSink &sink, PackedCard card) {
+  return sink << card.name();
+}
+
+//EFFECTS Writes card to sink, for example "Nine of Spades"
+OutputSink & operator<<(OutputSink &sink, const Card &card);
+
+// Writes to standard output.  Goes through the C stdio buffer of stdout,
+// which is also where std::cout writes while it is synced with stdio.
+class StdoutSink : public OutputSink {
+public:
+  //EFFECTS Initializes a sink for standard output.  An interactive sink
+  //  does no buffering of its own, so the transcript stays in order with
+  //  prompts that Human players print to std::cout.
+  explicit StdoutSink(bool interactive = false);
+
+  //EFFECTS Flushes standard output
+  ~StdoutSink();
+
+protected:
+  void write_through(const char *data, std::size_t size) override;
+  void sync() override;
+};
+
+// Writes to a file
+class FileSink : public OutputSink {
+public:
+  //EFFECTS Opens filename for writing, replacing its contents.  Check
+  //  is_open() to see if it worked.
+  explicit FileSink(const std::string &filename);
+
+  //EFFECTS Returns true if the file was opened
+  bool is_open() const;
+
+  //EFFECTS Flushes and closes the file
+  ~FileSink();
+
+protected:
+  void write_through(const char *data, std::size_t size) override;
+  void sync() override;
+
+private:
+  std::FILE *file;
+};
+
+// Discards everything written to it
+class NullSink : public OutputSink {
+protected:
+  void write_through(const char *, std::size_t) override {}
+};
+
+// Keeps everything written to it in memory
+class MemorySink : public OutputSink {
+public:
+  //EFFECTS Returns everything written since construction or the last clear()
+  const std::string & str();
+
+  //EFFECTS Discards everything written so far
+  void clear();
+
+protected:
+  void write_through(const char *data, std::size_t size) override;
+
+private:
+  std::string text;
+};
+
+#endif // OUTPUTSINK_HPP
@@ -0,0 +1,104 @@
+#include "OutputSink.hpp"
+#include "Game.hpp"
+#include "unit_test_framework.hpp"
+#include <fstream>
+#include <iostream>
+#include <sstream>
+#include <string>
+
+using namespace std;
+
+//numbers, text, cards and suits are written as ostream would
+TEST(test_memory_sink_formatting) {
+    MemorySink sink;
+    sink << "Hand " << 0 << '\n' << string("Adi") << " has " << -12 << "\n";
+    sink << Card(NINE, HEARTS) << " " << Card(ACE, DIAMONDS) << " " << CLUBS;
+    ASSERT_EQUAL(sink.str(),
+                 "Hand 0\nAdi has -12\nNine of Hearts Ace of Diamonds Clubs");
+    sink.clear();
+    ASSERT_EQUAL(sink.str(), "");
+}
+
+//every card matches Card's operator<<, including non-euchre ranks
+TEST(test_memory_sink_cards) {
+    for (int s = SPADES; s <= DIAMONDS; ++s) {
+        for (int r = TWO; r <= ACE; ++r) {
+            Card card(static_cast<Rank>(r), static_cast<Suit>(s));
+            MemorySink sink;
+            sink << card;
+            ostringstream expected;
+            expected << card;
+            ASSERT_EQUAL(sink.str(), expected.str());
+        }
+    }
+}
+
+//writes bigger than the buffer, and many small ones, keep their order
+TEST(test_memory_sink_large_writes) {
+    MemorySink sink;
+    string expected;
+    string big(10000, 'x');
+    for (int i = 0; i < 2000; ++i) {
+        sink << i << ' ';
+        expected += to_string(i) + " ";
+        if (i % 500 == 0) {
+            sink << big;
+            expected += big;
+        }
+    }
+    ASSERT_EQUAL(sink.str(), expected);
+}
+
+TEST(test_null_sink) {
+    NullSink sink;
+    sink << "anything" << 42 << Card(JACK, SPADES);
+    sink.flush();
+}
+
+TEST(test_file_sink) {
+    const string filename = "OutputSink_tests.tmp";
+    {
+        FileSink sink(filename);
+        ASSERT_TRUE(sink.is_open());
+        sink << "Nine of Hearts turned up\n" << 7 << "\n";
+    }
+    ifstream file(filename);
+    ostringstream contents;
+    contents << file.rdbuf();
+    ASSERT_EQUAL(contents.str(), "Nine of Hearts turned up\n7\n");
+    file.close();
+    remove(filename.c_str());
+}
+
+TEST(test_file_sink_bad_path) {
+    FileSink sink("no_such_directory/OutputSink_tests.tmp");
+    ASSERT_FALSE(sink.is_open());
+}
+
+//a game written to memory matches the saved transcript
+TEST(test_game_transcript) {
+    ifstream pack_file("pack.in");
+    Pack pack(pack_file);
+    vector<Player*> players = {
+        Player_factory("Adi", "Simple"),
+        Player_factory("Barbara", "Simple"),
+        Player_factory("Chi-Chih", "Simple"),
+        Player_factory("Dabbala", "Simple"),
+    };
+    ShuffleSetting no_shuffle = { ShuffleSetting::NO_SHUFFLE, 0, 0 };
+    MemorySink sink;
+    Game game({ pack, no_shuffle, 1 }, players, sink);
+    game.play();
+
+    ifstream correct_file("euchre_test00.out.correct");
+    string command_line;
+    getline(correct_file, command_line);
+    ostringstream correct;
+    correct << correct_file.rdbuf();
+    ASSERT_EQUAL(sink.str(), correct.str());
+    for (Player *player : players) {
+        delete player;
+    }
+}
+
+TEST_MAIN()
@@ -2,9 +2,70 @@
 #include <iostream>
 #include <array>
 #include "Pack.hpp"
+#include "AllocationTracker.hpp"
 
 using namespace std;
 
+namespace {
+
+const int NUM_CARDS = 24;
+const int IN_SHUFFLES = 7;
+
+// Position i of a shuffled pack takes the card at position perm[i]
+typedef array<int, NUM_CARDS> Permutation;
+
+// EFFECTS: Returns the permutation of seven perfect in-shuffles, composed
+//          at compile time so Pack::shuffle can apply it in one pass
+constexpr Permutation make_in_shuffle_permutation() {
+    // For a perfect in-shuffle:
+    // - Second half cards (12-23) go to even positions (0,2,4...)
+    // - First half cards (0-11) go to odd positions (1,3,5...)
+    Permutation once = {};
+    int mid = NUM_CARDS / 2;
+    for (int i = 0; i < mid; i++) {
+        once[2 * i] = mid + i;
+        once[2 * i + 1] = i;
+    }
+    Permutation result = {};
+    for (int i = 0; i < NUM_CARDS; i++) {
+        result[i] = i;
+    }
+    for (int shuffle_count = 0; shuffle_count < IN_SHUFFLES; shuffle_count++) {
+        Permutation next = {};
+        for (int i = 0; i < NUM_CARDS; i++) {
+            next[i] = result[once[i]];
+        }
+        result = next;
+    }
+    return result;
+}
+
+constexpr Permutation IN_SHUFFLE_PERMUTATION = make_in_shuffle_permutation();
+
+// EFFECTS: Returns how many times perm must be applied to get back to
+//          the starting order
+constexpr int permutation_order(const Permutation &perm) {
+    Permutation current = perm;
+    int order = 1;
+    while (true) {
+        bool identity = true;
+        for (int i = 0; i < NUM_CARDS; i++) {
+            identity = identity && current[i] == i;
+        }
+        if (identity) {
+            return order;
+        }
+        Permutation next = {};
+        for (int i = 0; i < NUM_CARDS; i++) {
+            next[i] = current[perm[i]];
+        }
+        current = next;
+        order++;
+    }
+}
+
+} // namespace
+
   // EFFECTS: Initializes the Pack to be in the following standard order:
   //          the cards of the lowest suit arranged from lowest rank to
   //          highest rank, followed by the cards of the next lowest suit
@@ -17,7 +78,7 @@ Pack::Pack() {
     // Initialize cards from NINE to ACE for each suit
     for (int suit = SPADES; suit <= DIAMONDS; suit++) {
         for (int rank = NINE; rank <= ACE; rank++) {
-            cards[i] = Card(static_cast<Rank>(rank), static_cast<Suit>(suit));
+            cards[i] = PackedCard(static_cast<Rank>(rank), static_cast<Suit>(suit));
             i++;
         }
     }
@@ -25,23 +86,26 @@ Pack::Pack() {
 }
 
 Pack::Pack(istream& pack_input) {
+    ALLOCATION_SCOPE(ALLOC_PACK);
     string rank;
     string suit;
     string extra;
     for (int i = 0; i < PACK_SIZE; ++i) {
         pack_input >> rank >> extra >> suit;
-        cards[i] = Card(string_to_rank(rank), string_to_suit(suit));
+        cards[i] = PackedCard(string_to_rank(rank), string_to_suit(suit));
     }
     reset();
 }
 
 Card Pack::deal_one() {
+    ALLOCATION_SCOPE(ALLOC_PACK);
     assert(next < PACK_SIZE);
     next++;
-    return cards[next - 1];
+    return cards[next - 1].to_card();
 }
 
 void Pack::reset() {
+    ALLOCATION_SCOPE(ALLOC_PACK);
     next = 0;
 }
 
@@ -49,19 +113,23 @@ void Pack::reset() {
   //          performs an in shuffle seven times. See
   //          https://en.wikipedia.org/wiki/In_shuffle.
 void Pack::shuffle() {
-    for (int shuffle_count = 0; shuffle_count < 7; shuffle_count++) {
-        array<Card, PACK_SIZE> temp = cards;
-        
-        // For a perfect in-shuffle:
-        // - Second half cards (12-23) go to even positions (0,2,4...)
-        // - First half cards (0-11) go to odd positions (1,3,5...)
-        int mid = PACK_SIZE / 2;
-        for (int i = 0; i < mid; i++) {
-            // Cards from second half (index mid+i) go to even positions (2*i)
-            cards[2 * i] = temp[mid + i];
-            // Cards from first half (index i) go to odd positions (2*i + 1)
-            cards[2 * i + 1] = temp[i];
-        }
+    ALLOCATION_SCOPE(ALLOC_PACK);
+    static_assert(NUM_CARDS == PACK_SIZE, "permutation covers the pack");
+    static_assert(permutation_order(IN_SHUFFLE_PERMUTATION) ==
+                  SHUFFLE_CYCLE_LENGTH, "shuffle cycle length");
+    // All seven in-shuffles at once
+    array<PackedCard, PACK_SIZE> temp = cards;
+    for (int i = 0; i < PACK_SIZE; i++) {
+        cards[i] = temp[IN_SHUFFLE_PERMUTATION[i]];
+    }
+    reset();
+}
+
+void Pack::shuffle(CounterRng &rng) {
+    ALLOCATION_SCOPE(ALLOC_PACK);
+    for (int i = PACK_SIZE - 1; i > 0; i--) {
+        int j = rng.below(i + 1);
+        swap(cards[i], cards[j]);
     }
     reset();
 }
@@ -69,4 +137,9 @@ void Pack::shuffle() {
 bool Pack::empty() const {
     return next >= PACK_SIZE;
 }
+
+PackedCard Pack::card_at(int index) const {
+    assert(0 <= index && index < PACK_SIZE);
+    return cards[index];
+}
     
\ No newline at end of file
@@ -10,6 +10,8 @@
 
 
 #include "Card.hpp"
+#include "PackedCard.hpp"
+#include "Rng.hpp"
 #include <array>
 #include <string>
 
@@ -25,7 +27,8 @@ public:
   Pack();
 
   // REQUIRES: pack_input contains a representation of a Pack in the
-  //           format required by the project specification
+  //           format required by the project specification, and every
+  //           card is a euchre card (Nine or higher)
   // MODIFIES: pack_input
   // EFFECTS: Initializes Pack by reading from pack_input.
   // NOTE: The pack is initially full, with no cards dealt.
@@ -43,12 +46,28 @@ public:
   //          https://en.wikipedia.org/wiki/In_shuffle.
   void shuffle();
 
+  // Number of calls to shuffle() that return any pack to its original order.
+  // Repeated shuffles visit a cycle of this many different orders.
+  static const int SHUFFLE_CYCLE_LENGTH = 20;
+
+  // MODIFIES: rng
+  // EFFECTS: Shuffles the Pack uniformly at random and resets the next
+  //          index.  This performs a Fisher-Yates shuffle that draws its
+  //          random numbers from rng, so the same stream always gives the
+  //          same order.
+  void shuffle(CounterRng &rng);
+
   // EFFECTS: returns true if there are no more cards left in the pack
   bool empty() const;
 
+  // REQUIRES: 0 <= index < 24
+  // EFFECTS: Returns the card at index in the pack order, dealt or not
+  PackedCard card_at(int index) const;
+
 private:
   static const int PACK_SIZE = 24;
-  std::array<Card, PACK_SIZE> cards;
+  // One byte per card, so the whole pack is a single cache line
+  std::array<PackedCard, PACK_SIZE> cards;
   int next; //index of next card to be dealt
 };
 
@@ -123,4 +123,53 @@ TEST(test_pack_reset_after_empty) {
     ASSERT_EQUAL(SPADES, first.get_suit());
 }
 
+// The in-shuffle cycle returns the pack to its original order
+TEST(test_pack_shuffle_cycle) {
+    Pack pack;
+    Pack original;
+    for (int i = 0; i < Pack::SHUFFLE_CYCLE_LENGTH; ++i) {
+        pack.shuffle();
+    }
+    for (int i = 0; i < 24; ++i) {
+        ASSERT_EQUAL(original.deal_one(), pack.deal_one());
+    }
+}
+
+// Random shuffle deals every card exactly once
+TEST(test_pack_random_shuffle_permutation) {
+    Pack pack;
+    CounterRng rng(280, 0);
+    pack.shuffle(rng);
+    bool seen[24] = {};
+    for (int i = 0; i < 24; ++i) {
+        Card card = pack.deal_one();
+        int index = card.get_suit() * 6 + card.get_rank() - NINE;
+        ASSERT_FALSE(seen[index]);
+        seen[index] = true;
+    }
+    ASSERT_TRUE(pack.empty());
+}
+
+// Random shuffle depends only on the seed and stream
+TEST(test_pack_random_shuffle_reproducible) {
+    Pack pack1;
+    Pack pack2;
+    Pack pack3;
+    CounterRng rng1(280, 7);
+    CounterRng rng2(280, 7);
+    CounterRng rng3(280, 8);
+    pack1.shuffle(rng1);
+    pack2.shuffle(rng2);
+    pack3.shuffle(rng3);
+    bool found_difference = false;
+    for (int i = 0; i < 24; ++i) {
+        Card card1 = pack1.deal_one();
+        ASSERT_EQUAL(card1, pack2.deal_one());
+        if (card1 != pack3.deal_one()) {
+            found_difference = true;
+        }
+    }
+    ASSERT_TRUE(found_difference);
+}
+
 TEST_MAIN()
@@ -0,0 +1,142 @@
+#ifndef PACKEDCARD_HPP
+#define PACKEDCARD_HPP
+/* PackedCard.hpp
+ *
+ * Represents a single euchre card in one byte.  The byte holds the card's
+ * position in the standard Pack order (0 = Nine of Spades, 23 = Ace of
+ * Diamonds), so a whole 24-card deck is 24 bytes and fits in one cache line.
+ * Every accessor is constexpr; conversion to and from Card is provided for
+ * code that still works with Card.
+ */
+
+#include "Card.hpp"
+#include <cstdint>
+#include <string_view>
+
+namespace packed_card_detail {
+  // Printed names, so printing a card or suit is a single copy
+  constexpr std::string_view SUIT_NAMES[] = {
+    "Spades", "Hearts", "Clubs", "Diamonds",
+  };
+  constexpr std::string_view CARD_NAMES[] = {
+    "Nine of Spades", "Ten of Spades", "Jack of Spades",
+    "Queen of Spades", "King of Spades", "Ace of Spades",
+    "Nine of Hearts", "Ten of Hearts", "Jack of Hearts",
+    "Queen of Hearts", "King of Hearts", "Ace of Hearts",
+    "Nine of Clubs", "Ten of Clubs", "Jack of Clubs",
+    "Queen of Clubs", "King of Clubs", "Ace of Clubs",
+    "Nine of Diamonds", "Ten of Diamonds", "Jack of Diamonds",
+    "Queen of Diamonds", "King of Diamonds", "Ace of Diamonds",
+  };
+}
+
+class PackedCard {
+public:
+  // Number of distinct cards in a euchre pack
+  static const int NUM_CARDS = 24;
+
+  // Number of cards of each suit in a euchre pack (Nine through Ace)
+  static const int CARDS_PER_SUIT = 6;
+
+  //EFFECTS Initializes PackedCard to the Nine of Spades
+  constexpr PackedCard() : code(0) {}
+
+  //REQUIRES 0 <= index < NUM_CARDS
+  //EFFECTS Initializes PackedCard to the card at index in the Pack order
+  constexpr explicit PackedCard(int index)
+    : code(static_cast<uint8_t>(index)) {}
+
+  //REQUIRES rank_in is NINE or higher
+  //EFFECTS Initializes PackedCard to specified rank and suit
+  constexpr PackedCard(Rank rank_in, Suit suit_in)
+    : code(static_cast<uint8_t>(suit_in * CARDS_PER_SUIT + (rank_in - NINE))) {}
+
+  //REQUIRES card is a euchre card (Nine or higher)
+  //EFFECTS Initializes PackedCard to the same card as card
+  explicit PackedCard(const Card &card)
+    : PackedCard(card.get_rank(), card.get_suit()) {}
+
+  //EFFECTS Returns the equivalent Card
+  Card to_card() const {
+    return Card(get_rank(), get_suit());
+  }
+
+  //EFFECTS Returns the position of the card in the Pack order, 0..23
+  constexpr int index() const {
+    return code;
+  }
+
+  //EFFECTS Returns the rank
+  constexpr Rank get_rank() const {
+    return static_cast<Rank>(NINE + code % CARDS_PER_SUIT);
+  }
+
+  //EFFECTS Returns the suit.  Does not consider trump.
+  constexpr Suit get_suit() const {
+    return static_cast<Suit>(code / CARDS_PER_SUIT);
+  }
+
+  //EFFECTS Returns the suit, the left bower is the trump suit
+  constexpr Suit get_suit(Suit trump) const {
+    return is_left_bower(trump) ? trump : get_suit();
+  }
+
+  //EFFECTS Returns true if card is a face card (Jack, Queen, King or Ace)
+  constexpr bool is_face_or_ace() const {
+    return get_rank() >= JACK;
+  }
+
+  //EFFECTS Returns true if card is the Jack of the trump suit
+  constexpr bool is_right_bower(Suit trump) const {
+    return *this == PackedCard(JACK, trump);
+  }
+
+  //EFFECTS Returns true if card is the Jack of the next suit
+  constexpr bool is_left_bower(Suit trump) const {
+    return *this == PackedCard(JACK, next_suit(trump));
+  }
+
+  //EFFECTS Returns true if the card is a trump card, including the left bower
+  constexpr bool is_trump(Suit trump) const {
+    return get_suit(trump) == trump;
+  }
+
+  //EFFECTS Returns the printed name, for example "Nine of Spades"
+  constexpr std::string_view name() const {
+    return packed_card_detail::CARD_NAMES[code];
+  }
+
+  //EFFECTS Returns the printed name of suit, for example "Spades"
+  static constexpr std::string_view suit_name(Suit suit) {
+    return packed_card_detail::SUIT_NAMES[suit];
+  }
+
+  //EFFECTS Returns true if lhs is same card as rhs
+  friend constexpr bool operator==(PackedCard lhs, PackedCard rhs) {
+    return lhs.code == rhs.code;
+  }
+
+  //EFFECTS Returns true if lhs is not the same card as rhs
+  friend constexpr bool operator!=(PackedCard lhs, PackedCard rhs) {
+    return lhs.code != rhs.code;
+  }
+
+  //EFFECTS Returns the suit of the same color, same as Suit_next.
+  //  Suit_next pairs Spades with Clubs and Hearts with Diamonds, which is
+  //  flipping bit 1 of the enum value.
+  static constexpr Suit next_suit(Suit suit) {
+    return static_cast<Suit>(suit ^ 2);
+  }
+
+private:
+  uint8_t code;
+};
+
+static_assert(sizeof(PackedCard) == 1, "PackedCard must be one byte");
+
+//EFFECTS Prints PackedCard to stream, for example "Nine of Spades"
+inline std::ostream & operator<<(std::ostream &os, PackedCard card) {
+  return os << card.name();
+}
+
+#endif // PACKEDCARD_HPP
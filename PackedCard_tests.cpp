@@ -0,0 +1,70 @@
+#include "PackedCard.hpp"
+#include "unit_test_framework.hpp"
+#include <iostream>
+
+using namespace std;
+
+// Accessors are usable in constant expressions
+static_assert(PackedCard(JACK, CLUBS).get_rank() == JACK, "rank");
+static_assert(PackedCard(JACK, CLUBS).get_suit() == CLUBS, "suit");
+static_assert(PackedCard(JACK, CLUBS).get_suit(SPADES) == SPADES, "left bower");
+static_assert(PackedCard(JACK, CLUBS).is_left_bower(SPADES), "left bower");
+
+//constructors
+TEST(test_packed_ctor) {
+    PackedCard c(ACE, HEARTS);
+    ASSERT_EQUAL(ACE, c.get_rank());
+    ASSERT_EQUAL(HEARTS, c.get_suit());
+    ASSERT_EQUAL(11, c.index());
+}
+TEST(test_packed_default) {
+    PackedCard c;
+    ASSERT_EQUAL(NINE, c.get_rank());
+    ASSERT_EQUAL(SPADES, c.get_suit());
+}
+//conversion to and from Card
+TEST(test_packed_round_trip) {
+    for (int i = 0; i < PackedCard::NUM_CARDS; ++i) {
+        PackedCard packed(i);
+        Card card = packed.to_card();
+        ASSERT_EQUAL(packed.get_rank(), card.get_rank());
+        ASSERT_EQUAL(packed.get_suit(), card.get_suit());
+        ASSERT_TRUE(PackedCard(card) == packed);
+    }
+}
+//trump accessors agree with Card
+TEST(test_packed_matches_card) {
+    for (int i = 0; i < PackedCard::NUM_CARDS; ++i) {
+        PackedCard packed(i);
+        Card card = packed.to_card();
+        ASSERT_EQUAL(card.is_face_or_ace(), packed.is_face_or_ace());
+        for (int s = SPADES; s <= DIAMONDS; ++s) {
+            Suit trump = static_cast<Suit>(s);
+            ASSERT_EQUAL(card.get_suit(trump), packed.get_suit(trump));
+            ASSERT_EQUAL(card.is_right_bower(trump), packed.is_right_bower(trump));
+            ASSERT_EQUAL(card.is_left_bower(trump), packed.is_left_bower(trump));
+            ASSERT_EQUAL(card.is_trump(trump), packed.is_trump(trump));
+        }
+    }
+}
+//output
+TEST(test_packed_output) {
+    ostringstream output;
+    output << PackedCard(NINE, DIAMONDS);
+    ASSERT_EQUAL("Nine of Diamonds", output.str());
+}
+//names agree with Card's operator<<
+TEST(test_packed_names) {
+    for (int i = 0; i < PackedCard::NUM_CARDS; ++i) {
+        PackedCard packed(i);
+        ostringstream card_output;
+        card_output << packed.to_card();
+        ASSERT_EQUAL(card_output.str(), string(packed.name()));
+        ostringstream suit_output;
+        suit_output << packed.get_suit();
+        ASSERT_EQUAL(suit_output.str(),
+                     string(PackedCard::suit_name(packed.get_suit())));
+    }
+}
+
+TEST_MAIN()
@@ -0,0 +1,160 @@
+#include "PhaseTimer.hpp"
+#include <algorithm>
+#include <iomanip>
+#include <iostream>
+#include <mutex>
+#include <string>
+#include <vector>
+
+using namespace std;
+
+namespace {
+
+struct ThreadTimes {
+  PhaseTimes phases[NUM_TIMED_PHASES];
+};
+
+const char * const PHASE_NAMES[NUM_TIMED_PHASES] = {
+  "Game::shuffle",
+  "Game::deal",
+  "Game::make_trump",
+  "Game::play_hand",
+  "Game::update_scores",
+  "Player::make_trump",
+  "Player::add_and_discard",
+  "Player::lead_card",
+  "Player::play_card",
+};
+
+// Width of the longest histogram bar
+const int BAR_WIDTH = 40;
+
+// Guards the list of tables, not the times in them: see PhaseTimer.hpp
+mutex tables_mutex;
+
+// The tables of every thread that has recorded a time.  Neither they nor
+// the list are ever freed, so the times of finished threads can still be
+// read, even by an atexit handler after static destructors have run.
+vector<ThreadTimes*> & tables() {
+  static vector<ThreadTimes*> *all = new vector<ThreadTimes*>;
+  return *all;
+}
+
+ThreadTimes & this_thread_times() {
+  thread_local ThreadTimes *times = nullptr;
+  if (!times) {
+    times = new ThreadTimes();
+    lock_guard<mutex> lock(tables_mutex);
+    tables().push_back(times);
+  }
+  return *times;
+}
+
+// EFFECTS: Returns the histogram bucket of a time of ns nanoseconds
+int time_bucket(long long ns) {
+  if (ns < 2) {
+    return 0;
+  }
+  return min(63 - __builtin_clzll(ns), NUM_TIME_BUCKETS - 1);
+}
+
+// EFFECTS: Returns the end of the bucket where a fraction of the times
+//          are shorter, a bound on that percentile
+long long percentile_ns(const PhaseTimes &times, double fraction) {
+  long long seen = 0;
+  for (int bucket = 0; bucket < NUM_TIME_BUCKETS; ++bucket) {
+    seen += times.histogram[bucket];
+    if (seen >= fraction * times.count) {
+      return 2LL << bucket;
+    }
+  }
+  return times.max_ns;
+}
+
+} // namespace
+
+PhaseTimes phase_times(TimedPhase phase) {
+  PhaseTimes sum = {};
+  lock_guard<mutex> lock(tables_mutex);
+  for (ThreadTimes *table : tables()) {
+    const PhaseTimes &times = table->phases[phase];
+    if (times.count == 0) {
+      continue;
+    }
+    sum.min_ns = sum.count == 0 ? times.min_ns : min(sum.min_ns, times.min_ns);
+    sum.max_ns = max(sum.max_ns, times.max_ns);
+    sum.count += times.count;
+    sum.total_ns += times.total_ns;
+    for (int bucket = 0; bucket < NUM_TIME_BUCKETS; ++bucket) {
+      sum.histogram[bucket] += times.histogram[bucket];
+    }
+  }
+  return sum;
+}
+
+void record_phase_time(TimedPhase phase, long long ns) {
+  PhaseTimes &times = this_thread_times().phases[phase];
+  if (times.count == 0 || ns < times.min_ns) {
+    times.min_ns = ns;
+  }
+  times.max_ns = max(times.max_ns, ns);
+  times.count++;
+  times.total_ns += ns;
+  times.histogram[time_bucket(ns)]++;
+}
+
+void reset_phase_times() {
+  lock_guard<mutex> lock(tables_mutex);
+  for (ThreadTimes *table : tables()) {
+    for (PhaseTimes &times : table->phases) {
+      times = PhaseTimes();
+    }
+  }
+}
+
+const char * phase_name(TimedPhase phase) {
+  return PHASE_NAMES[phase];
+}
+
+void print_phase_times(ostream &os) {
+  PhaseTimes all[NUM_TIMED_PHASES];
+  for (int phase = 0; phase < NUM_TIMED_PHASES; ++phase) {
+    all[phase] = phase_times(static_cast<TimedPhase>(phase));
+  }
+
+  os << left << setw(26) << "phase" << right << setw(12) << "count"
+     << setw(12) << "total ms" << setw(10) << "mean ns" << setw(10)
+     << "p50 ns" << setw(10) << "p99 ns" << setw(12) << "max ns" << '\n';
+  for (int phase = 0; phase < NUM_TIMED_PHASES; ++phase) {
+    const PhaseTimes &times = all[phase];
+    if (times.count == 0) {
+      continue;
+    }
+    os << left << setw(26) << PHASE_NAMES[phase] << right
+       << setw(12) << times.count << fixed << setprecision(3)
+       << setw(12) << times.total_ns / 1e6
+       << setw(10) << times.total_ns / times.count
+       << setw(10) << "<" + to_string(percentile_ns(times, 0.5))
+       << setw(10) << "<" + to_string(percentile_ns(times, 0.99))
+       << setw(12) << times.max_ns << '\n';
+  }
+
+  for (int phase = 0; phase < NUM_TIMED_PHASES; ++phase) {
+    const PhaseTimes &times = all[phase];
+    if (times.count == 0) {
+      continue;
+    }
+    os << '\n' << PHASE_NAMES[phase] << '\n';
+    long long most = *max_element(begin(times.histogram),
+                                  end(times.histogram));
+    for (int bucket = 0; bucket < NUM_TIME_BUCKETS; ++bucket) {
+      long long count = times.histogram[bucket];
+      if (count == 0) {
+        continue;
+      }
+      long long low = bucket == 0 ? 0 : 1LL << bucket;
+      os << right << setw(14) << low << " ns" << setw(12) << count << ' '
+         << string(max<long long>(1, count * BAR_WIDTH / most), '#') << '\n';
+    }
+  }
+}
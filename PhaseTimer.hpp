@@ -0,0 +1,102 @@
+#ifndef PHASETIMER_HPP
+#define PHASETIMER_HPP
+/* PhaseTimer.hpp
+ *
+ * Opt-in timing of where a game spends its time, for finding out which
+ * phase of a hand or which decision of a slow strategy is the slow one.
+ * Built with TIME_PHASES defined and PhaseTimer.cpp linked in (see
+ * euchre_timed.exe in the Makefile), every PHASE_TIMER measures the
+ * steady_clock time until the end of its scope and adds it to a latency
+ * histogram of its phase.  Game times each phase of a hand and each
+ * decision it asks of a Player.  Phases nest: the time of play_hand
+ * includes the time its players took to choose their cards.
+ *
+ * Each thread records into its own tables, so timing a Tournament does
+ * not make its threads contend; the tables are summed when read.  The
+ * tables are plain counters, not atomics, so read or reset them only while
+ * no thread is recording, for example once a Tournament's run() returns
+ * and its worker threads have joined.
+ *
+ * Without TIME_PHASES, PHASE_TIMER is empty and nothing here is compiled
+ * in.
+ */
+
+#include <chrono>
+#include <iosfwd>
+
+enum TimedPhase {
+  PHASE_SHUFFLE,                // Game shuffling or resetting the pack
+  PHASE_DEAL,                   // Game::deal
+  PHASE_MAKE_TRUMP,             // Game::make_trump, both rounds of bidding
+  PHASE_PLAY_HAND,              // Game::play_hand, all five tricks
+  PHASE_UPDATE_SCORES,          // Game::update_scores
+  PHASE_DECIDE_MAKE_TRUMP,      // Player::make_trump
+  PHASE_DECIDE_ADD_AND_DISCARD, // Player::add_and_discard
+  PHASE_DECIDE_LEAD_CARD,       // Player::lead_card
+  PHASE_DECIDE_PLAY_CARD,       // Player::play_card
+  NUM_TIMED_PHASES
+};
+
+// Bucket i of a histogram counts times of [2^i, 2^(i+1)) nanoseconds,
+// except that bucket 0 also counts times under a nanosecond and the last
+// bucket everything longer
+const int NUM_TIME_BUCKETS = 40;
+
+struct PhaseTimes {
+  long long count;
+  long long total_ns;
+  long long min_ns;
+  long long max_ns;
+  long long histogram[NUM_TIME_BUCKETS];
+};
+
+// REQUIRES: No other thread is recording times
+// EFFECTS: Returns the times recorded for phase since the last reset, on
+//          every thread
+PhaseTimes phase_times(TimedPhase phase);
+
+// EFFECTS: Adds one time of ns nanoseconds to phase, for this thread
+void record_phase_time(TimedPhase phase, long long ns);
+
+// REQUIRES: No other thread is recording times
+// EFFECTS: Sets every phase's times back to none, on every thread
+void reset_phase_times();
+
+// EFFECTS: Returns the name of phase, for example "Game::deal"
+const char * phase_name(TimedPhase phase);
+
+// REQUIRES: No other thread is recording times
+// MODIFIES: os
+// EFFECTS: Prints a summary line and a histogram for every phase with
+//          times recorded
+void print_phase_times(std::ostream &os);
+
+// Times the rest of its scope
+class PhaseTimer {
+public:
+  // EFFECTS: Starts timing phase
+  explicit PhaseTimer(TimedPhase phase_in)
+    : phase(phase_in), start(std::chrono::steady_clock::now()) {}
+
+  // EFFECTS: Records the time since the timer was made
+  ~PhaseTimer() {
+    record_phase_time(phase, std::chrono::duration_cast<
+      std::chrono::nanoseconds>(std::chrono::steady_clock::now() - start)
+      .count());
+  }
+
+  PhaseTimer(const PhaseTimer &) = delete;
+  PhaseTimer & operator=(const PhaseTimer &) = delete;
+
+private:
+  TimedPhase phase;
+  std::chrono::steady_clock::time_point start;
+};
+
+#ifdef TIME_PHASES
+#define PHASE_TIMER(phase) PhaseTimer phase_timer(phase)
+#else
+#define PHASE_TIMER(phase)
+#endif
+
+#endif // PHASETIMER_HPP
@@ -0,0 +1,89 @@
+#include "Game.hpp"
+#include "PhaseTimer.hpp"
+#include "Player.hpp"
+#include "Tournament.hpp"
+#include "unit_test_framework.hpp"
+#include <cmath>
+#include <sstream>
+#include <string>
+#include <vector>
+
+using namespace std;
+
+const vector<string> NAMES = { "Adi", "Barbara", "Chi-Chih", "Dabbala" };
+const ShuffleSetting RANDOM = { ShuffleSetting::RANDOM, 280, 0 };
+
+//times land in the bucket of their power of two
+TEST(test_phase_histogram) {
+    reset_phase_times();
+    record_phase_time(PHASE_DEAL, 1);
+    record_phase_time(PHASE_DEAL, 3);
+    record_phase_time(PHASE_DEAL, 1000);
+    record_phase_time(PHASE_DEAL, 1LL << 50);
+    PhaseTimes times = phase_times(PHASE_DEAL);
+    ASSERT_EQUAL(times.count, 4);
+    ASSERT_EQUAL(times.total_ns, 1004 + (1LL << 50));
+    ASSERT_EQUAL(times.min_ns, 1);
+    ASSERT_EQUAL(times.max_ns, 1LL << 50);
+    ASSERT_EQUAL(times.histogram[0], 1);
+    ASSERT_EQUAL(times.histogram[1], 1);
+    ASSERT_EQUAL(times.histogram[9], 1);
+    ASSERT_EQUAL(times.histogram[NUM_TIME_BUCKETS - 1], 1);
+    ASSERT_EQUAL(phase_times(PHASE_SHUFFLE).count, 0);
+
+    reset_phase_times();
+    ASSERT_EQUAL(phase_times(PHASE_DEAL).count, 0);
+    ASSERT_EQUAL(phase_times(PHASE_DEAL).histogram[9], 0);
+}
+
+TEST(test_phase_names) {
+    ASSERT_EQUAL(string(phase_name(PHASE_PLAY_HAND)), "Game::play_hand");
+    ASSERT_EQUAL(string(phase_name(PHASE_DECIDE_LEAD_CARD)),
+                 "Player::lead_card");
+}
+
+//every phase of every hand is timed once, and every decision once
+TEST(test_phase_game) {
+    vector<Player*> players;
+    for (int seat = 0; seat < 4; ++seat) {
+        players.push_back(Player_factory(NAMES[seat], "Simple"));
+    }
+    NullSink out;
+    reset_phase_times();
+    Game game({ Pack(), RANDOM, 10 }, players, out);
+    long long hands = game.play().hands;
+    ASSERT_EQUAL(phase_times(PHASE_SHUFFLE).count, hands);
+    ASSERT_EQUAL(phase_times(PHASE_DEAL).count, hands);
+    ASSERT_EQUAL(phase_times(PHASE_MAKE_TRUMP).count, hands);
+    ASSERT_EQUAL(phase_times(PHASE_PLAY_HAND).count, hands);
+    ASSERT_EQUAL(phase_times(PHASE_UPDATE_SCORES).count, hands);
+    ASSERT_EQUAL(phase_times(PHASE_DECIDE_LEAD_CARD).count, 5 * hands);
+    ASSERT_EQUAL(phase_times(PHASE_DECIDE_PLAY_CARD).count, 15 * hands);
+    long long bids = phase_times(PHASE_DECIDE_MAKE_TRUMP).count;
+    ASSERT_TRUE(bids >= hands && bids <= 8 * hands);
+    ASSERT_TRUE(phase_times(PHASE_DECIDE_ADD_AND_DISCARD).count <= hands);
+    // A hand takes longer than any one card played in it
+    ASSERT_TRUE(phase_times(PHASE_PLAY_HAND).max_ns >=
+                phase_times(PHASE_DECIDE_PLAY_CARD).min_ns);
+
+    ostringstream report;
+    print_phase_times(report);
+    ASSERT_TRUE(report.str().find("Game::play_hand") != string::npos);
+    ASSERT_TRUE(report.str().find("Player::play_card") != string::npos);
+    for (Player *player : players) {
+        delete player;
+    }
+}
+
+//the times of every thread of a tournament are counted
+TEST(test_phase_threads) {
+    vector<string> strategies(4, "Simple");
+    Tournament tournament({ Pack(), RANDOM, 10 }, NAMES, strategies);
+    reset_phase_times();
+    GameTotals totals = tournament.run(20, 3);
+    long long hands = llround(totals.get_average_hands() * totals.get_games());
+    ASSERT_EQUAL(phase_times(PHASE_PLAY_HAND).count, hands);
+    ASSERT_EQUAL(phase_times(PHASE_DECIDE_LEAD_CARD).count, 5 * hands);
+}
+
+TEST_MAIN()
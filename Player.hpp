@@ -14,6 +14,8 @@
 #include <string>
 #include <vector>
 
+class Arena;
+
 class Player {
  public:
   //EFFECTS returns player's name
@@ -46,6 +48,22 @@ class Player {
   //  The card is removed from the player's hand.
   virtual Card play_card(const Card &led_card, Suit trump) = 0;
 
+  //REQUIRES 0 <= seat < 4, 0 <= dealer < 4
+  //EFFECTS  Tells the Player that a hand has been dealt: the Player sits in
+  //  seat, dealer deals and upcard is turned up.  Called for every Player
+  //  before the first make_trump of the hand.  Strategies that do not keep
+  //  track of the hand ignore this and the two calls below.
+  virtual void start_hand(int seat, int dealer, const Card &upcard) {}
+
+  //REQUIRES round is 1 or 2
+  //EFFECTS  Tells the Player that the player in seat maker ordered up trump
+  //  in round.  In round 1 this comes before the dealer's add_and_discard.
+  virtual void trump_made(int maker, Suit trump, int round) {}
+
+  //EFFECTS  Tells the Player that the player in seat played card, including
+  //  cards the Player plays itself
+  virtual void card_played(int seat, const Card &card) {}
+
   // Maximum number of cards in a player's hand
   static const int MAX_HAND_SIZE = 5;
 
@@ -60,6 +78,18 @@ class Player {
 //Don't forget to call "delete" on each Player* after the game is over
 Player * Player_factory(const std::string &name, const std::string &strategy);
 
+//MODIFIES arena
+//EFFECTS: Same as above, but the player is placed in arena instead of on
+//the heap.  Do not delete it; it is destroyed when arena is reset.
+Player * Player_factory(const std::string &name, const std::string &strategy,
+                        Arena &arena);
+
+//EFFECTS: Returns true if Player_factory can make a player with strategy:
+//"Simple", "Human", "MonteCarlo", "MonteCarlo:N" for N sampled deals per
+//decision, "ISMCTS", "ISMCTS:N" for N search iterations per card played,
+//or "ISMCTS:Nms" to search for N milliseconds per card
+bool Player_strategy_exists(const std::string &strategy);
+
 //EFFECTS: Prints player's name to os
 std::ostream & operator<<(std::ostream &os, const Player &p);
 
@@ -0,0 +1,109 @@
+#include "Replay.hpp"
+#include "TrumpOrder.hpp"
+
+using namespace std;
+
+namespace {
+
+// Pack position of the upcard, the first card after the deal
+const int UPCARD_POSITION = 20;
+
+// EFFECTS: Writes the bids of hand and returns the seat that made trump
+int replay_bids(const GameLog &log, const HandLog &hand, OutputSink &out) {
+  out << hand.pack[UPCARD_POSITION] << " turned up\n";
+  int passes = hand.passes;
+  if (passes == HandLog::DEALER_FORCED) {
+    // All eight bids were passes, then the dealer had to pick a suit
+    for (int i = 1; i <= 8; ++i) {
+      out << log.get_name((hand.dealer + i) % 4) << " passes\n";
+    }
+    out << log.get_name(hand.dealer) << " must order up " << hand.trump
+        << "\n\n";
+    return hand.dealer;
+  }
+  for (int i = 1; i <= passes; ++i) {
+    out << log.get_name((hand.dealer + i) % 4) << " passes\n";
+  }
+  int maker = (hand.dealer + passes + 1) % 4;
+  out << log.get_name(maker) << " orders up " << hand.trump << "\n\n";
+  return maker;
+}
+
+// EFFECTS: Writes the five tricks of hand and returns the number of tricks
+//          taken by the team of players 0 and 2
+int replay_tricks(const GameLog &log, const HandLog &hand, OutputSink &out) {
+  int leader = (hand.dealer + 1) % 4;
+  int team_0_tricks = 0;
+  for (int trick = 0; trick < 5; ++trick) {
+    const PackedCard *cards = &hand.plays[trick * 4];
+    out << cards[0] << " led by " << log.get_name(leader) << "\n";
+    Suit led_suit = cards[0].get_suit(hand.trump);
+    int highest_strength = trick_strength(cards[0], led_suit, hand.trump);
+    int winner = leader;
+    for (int i = 1; i < 4; ++i) {
+      int seat = (leader + i) % 4;
+      out << cards[i] << " played by " << log.get_name(seat) << "\n";
+      int strength = trick_strength(cards[i], led_suit, hand.trump);
+      if (strength > highest_strength) {
+        highest_strength = strength;
+        winner = seat;
+      }
+    }
+    out << log.get_name(winner) << " takes the trick\n\n";
+    team_0_tricks += winner % 2 == 0;
+    leader = winner;
+  }
+  return team_0_tricks;
+}
+
+// EFFECTS: Writes the players of team, for example "Adi and Chi-Chih"
+void write_team(const GameLog &log, int team, OutputSink &out) {
+  out << log.get_name(team) << " and " << log.get_name(team + 2);
+}
+
+// MODIFIES: scores, out
+// EFFECTS: Writes hand h of log and adds the points it scored to scores
+void replay_hand(const GameLog &log, int h, int scores[2], OutputSink &out) {
+  HandLog hand = log.get_hand(h);
+  out << "Hand " << h << "\n" << log.get_name(hand.dealer) << " deals\n";
+  int maker_team = replay_bids(log, hand, out) % 2;
+  int team_0_tricks = replay_tricks(log, hand, out);
+  int maker_tricks = maker_team == 0 ? team_0_tricks : 5 - team_0_tricks;
+
+  if (maker_tricks >= 3) {
+    write_team(log, maker_team, out);
+    out << " win the hand\n";
+    scores[maker_team] += maker_tricks == 5 ? 2 : 1;
+    if (maker_tricks == 5) {
+      out << "march!\n";
+    }
+  } else {
+    write_team(log, 1 - maker_team, out);
+    out << " win the hand\neuchred!\n";
+    scores[1 - maker_team] += 2;
+  }
+  for (int team = 0; team < 2; ++team) {
+    write_team(log, team, out);
+    out << " have " << scores[team] << " points\n";
+  }
+  out << "\n";
+}
+
+} // namespace
+
+bool replay_game(const GameLog &log, OutputSink &out) {
+  int points = log.get_points_to_win();
+  int scores[2] = { 0, 0 };
+  for (int h = 0; h < log.num_hands(); ++h) {
+    if (scores[0] >= points || scores[1] >= points) {
+      return false; // hands logged after the game was won
+    }
+    replay_hand(log, h, scores, out);
+  }
+  if (scores[0] < points && scores[1] < points) {
+    return false;
+  }
+  write_team(log, scores[0] >= points ? 0 : 1, out);
+  out << " win!\n";
+  return true;
+}
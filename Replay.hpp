@@ -0,0 +1,22 @@
+#ifndef REPLAY_HPP
+#define REPLAY_HPP
+/* Replay.hpp
+ *
+ * Rebuilds game transcripts from a GameLog.  The transcript is exactly what
+ * Game::play printed when the log was recorded, but no Players are needed
+ * and no strategy runs: every bid and play is read from the log, and only
+ * the trick winners and scores are worked out again.
+ */
+
+#include "GameLog.hpp"
+#include "OutputSink.hpp"
+
+// MODIFIES: out
+// EFFECTS: Writes the transcript of the game in log to out and returns
+//          true.  Returns false, after writing the hands before the
+//          problem but no winner, if the hands do not make a finished game:
+//          no team reaches the points to win, or hands follow the one that
+//          won.
+bool replay_game(const GameLog &log, OutputSink &out);
+
+#endif // REPLAY_HPP
@@ -0,0 +1,125 @@
+#include "Replay.hpp"
+#include "Game.hpp"
+#include "unit_test_framework.hpp"
+#include <fstream>
+#include <iostream>
+#include <sstream>
+#include <string>
+
+using namespace std;
+
+const vector<string> NAMES = { "Edsger", "Fran", "Gabriel", "Herb" };
+
+//plays a game, then checks the replay of its log against its transcript
+void check_replay(const Pack &pack, const ShuffleSetting &shuffle,
+                  int points, const vector<string> &types) {
+    vector<Player*> players;
+    for (int i = 0; i < 4; ++i) {
+        players.push_back(Player_factory(NAMES[i], types[i]));
+    }
+    MemorySink transcript;
+    Game game({ pack, shuffle, points }, players, transcript);
+    GameLog log;
+    game.set_log(&log);
+    game.play();
+
+    MemorySink replayed;
+    ASSERT_TRUE(replay_game(log, replayed));
+    ASSERT_EQUAL(replayed.str(), transcript.str());
+    for (Player *player : players) {
+        delete player;
+    }
+}
+
+const vector<string> SIMPLE = { "Simple", "Simple", "Simple", "Simple" };
+
+TEST(test_replay_no_shuffle) {
+    ShuffleSetting no_shuffle = { ShuffleSetting::NO_SHUFFLE, 0, 0 };
+    check_replay(Pack(), no_shuffle, 10, SIMPLE);
+}
+
+TEST(test_replay_in_shuffle) {
+    ShuffleSetting in_shuffle = { ShuffleSetting::IN_SHUFFLE, 0, 0 };
+    check_replay(Pack(), in_shuffle, 10, SIMPLE);
+}
+
+//many random games cover every kind of bid, march and euchre
+TEST(test_replay_random) {
+    for (uint64_t stream = 0; stream < 200; ++stream) {
+        ShuffleSetting random = { ShuffleSetting::RANDOM, 280, stream };
+        check_replay(Pack(), random, 10, SIMPLE);
+    }
+}
+
+//Human bids and discards come from cin, but replay the same way
+TEST(test_replay_human) {
+    ifstream input("euchre_test50.in");
+    streambuf *saved_cin = cin.rdbuf(input.rdbuf());
+    ostringstream prompts;
+    streambuf *saved_cout = cout.rdbuf(prompts.rdbuf());
+    ifstream pack_file("pack.in");
+    ShuffleSetting no_shuffle = { ShuffleSetting::NO_SHUFFLE, 0, 0 };
+    check_replay(Pack(pack_file), no_shuffle, 3,
+                 { "Human", "Human", "Human", "Human" });
+    cin.rdbuf(saved_cin);
+    cout.rdbuf(saved_cout);
+}
+
+//the replay matches the saved transcript, apart from the command line
+TEST(test_replay_saved_transcript) {
+    vector<Player*> players;
+    for (const char *name : { "Adi", "Barbara", "Chi-Chih", "Dabbala" }) {
+        players.push_back(Player_factory(name, "Simple"));
+    }
+    ifstream pack_file("pack.in");
+    ShuffleSetting no_shuffle = { ShuffleSetting::NO_SHUFFLE, 0, 0 };
+    NullSink sink;
+    Game game({ Pack(pack_file), no_shuffle, 1 }, players, sink);
+    GameLog log;
+    game.set_log(&log);
+    game.play();
+
+    MemorySink replayed;
+    ASSERT_TRUE(replay_game(log, replayed));
+    ifstream correct_file("euchre_test00.out.correct");
+    string command_line;
+    getline(correct_file, command_line);
+    ostringstream correct;
+    correct << correct_file.rdbuf();
+    ASSERT_EQUAL(replayed.str(), correct.str());
+    for (Player *player : players) {
+        delete player;
+    }
+}
+
+//a log that stops before the game is won, or goes on after it, has no
+//winner to print
+TEST(test_replay_unfinished) {
+    vector<Player*> players;
+    for (const string &name : NAMES) {
+        players.push_back(Player_factory(name, "Simple"));
+    }
+    ShuffleSetting in_shuffle = { ShuffleSetting::IN_SHUFFLE, 0, 0 };
+    NullSink sink;
+    Game game({ Pack(), in_shuffle, 10 }, players, sink);
+    GameLog log;
+    game.set_log(&log);
+    game.play();
+
+    GameLog short_log;
+    short_log.start(NAMES, 10);
+    for (int h = 0; h + 1 < log.num_hands(); ++h) {
+        short_log.add_hand(log.get_hand(h));
+    }
+    NullSink replayed;
+    ASSERT_FALSE(replay_game(short_log, replayed));
+
+    GameLog long_log = log;
+    long_log.add_hand(log.get_hand(0));
+    ASSERT_FALSE(replay_game(long_log, replayed));
+    for (Player *player : players) {
+        delete player;
+    }
+}
+
+TEST_MAIN()
@@ -0,0 +1,64 @@
+#ifndef RNG_HPP
+#define RNG_HPP
+/* Rng.hpp
+ *
+ * Counter-based random number streams.  The i-th number of a stream is a
+ * SplitMix64 hash of (key + i * GAMMA), where the key is a hash of the seed
+ * and a stream id.  A stream therefore depends only on (seed, stream id):
+ * game k of a run can use stream k and get the same numbers no matter
+ * which thread plays it or in what order, and no generator state is shared.
+ */
+
+#include <cstdint>
+
+class CounterRng {
+public:
+  //EFFECTS Initializes the stream identified by seed and stream_id
+  CounterRng(uint64_t seed, uint64_t stream_id)
+    : key(mix(seed ^ mix(stream_id + GAMMA))), counter(0) {}
+
+  //MODIFIES this
+  //EFFECTS Returns the next 64 random bits of the stream
+  uint64_t next() {
+    ++counter;
+    return mix(key + counter * GAMMA);
+  }
+
+  //REQUIRES bound > 0
+  //MODIFIES this
+  //EFFECTS Returns a uniformly distributed number in [0, bound).  Uses
+  //  Lemire's multiply-and-shift, rejecting the few values that would bias
+  //  the result.
+  uint32_t below(uint32_t bound) {
+    uint64_t product = static_cast<uint64_t>(next_32()) * bound;
+    uint32_t low = static_cast<uint32_t>(product);
+    if (low < bound) {
+      uint32_t threshold = (0u - bound) % bound;
+      while (low < threshold) {
+        product = static_cast<uint64_t>(next_32()) * bound;
+        low = static_cast<uint32_t>(product);
+      }
+    }
+    return static_cast<uint32_t>(product >> 32);
+  }
+
+private:
+  // Golden-ratio increment used by SplitMix64
+  static const uint64_t GAMMA = 0x9E3779B97F4A7C15ull;
+
+  uint64_t key;
+  uint64_t counter;
+
+  uint32_t next_32() {
+    return static_cast<uint32_t>(next() >> 32);
+  }
+
+  //EFFECTS Returns the SplitMix64 finalizer of z
+  static uint64_t mix(uint64_t z) {
+    z = (z ^ (z >> 30)) * 0xBF58476D1CE4E5B9ull;
+    z = (z ^ (z >> 27)) * 0x94D049BB133111EBull;
+    return z ^ (z >> 31);
+  }
+};
+
+#endif // RNG_HPP
@@ -0,0 +1,39 @@
+#include "Rng.hpp"
+#include "unit_test_framework.hpp"
+#include <iostream>
+
+using namespace std;
+
+// Streams depend only on (seed, stream id)
+TEST(test_rng_reproducible) {
+    CounterRng a(1, 2);
+    CounterRng b(1, 2);
+    for (int i = 0; i < 100; ++i) {
+        ASSERT_EQUAL(a.next(), b.next());
+    }
+}
+
+TEST(test_rng_streams_differ) {
+    CounterRng a(1, 2);
+    CounterRng b(1, 3);
+    CounterRng c(2, 2);
+    uint64_t first = a.next();
+    ASSERT_NOT_EQUAL(first, b.next());
+    ASSERT_NOT_EQUAL(first, c.next());
+}
+
+// below() stays in range and hits every value
+TEST(test_rng_below) {
+    CounterRng rng(280, 0);
+    int counts[6] = {};
+    for (int i = 0; i < 6000; ++i) {
+        uint32_t value = rng.below(6);
+        ASSERT_TRUE(value < 6);
+        counts[value]++;
+    }
+    for (int count : counts) {
+        ASSERT_TRUE(count > 800 && count < 1200);
+    }
+}
+
+TEST_MAIN()
@@ -0,0 +1,236 @@
+#ifndef SIMPLE_HPP
+#define SIMPLE_HPP
+/* Simple.hpp
+ *
+ * The Simple Player strategy: bids on its count of trump face cards, leads
+ * its highest card and follows with its highest card that follows suit,
+ * else its lowest.
+ *
+ * The class is final and defined in the header, so a game engine that
+ * holds Simple players by their own type (see BasicGame in Game.hpp) calls
+ * these directly and the compiler can inline them into the trick loop.
+ * Player_factory("Simple") makes the same player behind a Player pointer.
+ */
+
+#include "BidTable.hpp"
+#include "Card.hpp"
+#include "CardSet.hpp"
+#include "Player.hpp"
+#include <cassert>
+#include <string>
+
+class Simple final : public Player {
+private:
+    std::string name;
+    CardSet hand;
+public:
+    Simple(const std::string &name_in);
+    virtual const std::string & get_name() const override;
+
+    virtual void add_card(const Card &c) override;
+
+    virtual bool make_trump(const Card &upcard, bool is_dealer,
+        int round, Suit &order_up_suit) const override;
+
+    virtual void add_and_discard(const Card &upcard) override;
+
+    virtual Card lead_card(Suit trump) override;
+    
+    virtual Card play_card(const Card &led_card, Suit trump) override;
+
+    // Helper method to find cards that follow the led suit
+    CardSet find_following_suit_cards(const Card &led_card, Suit trump) const;
+
+    // Helper method to find the best card among those that follow suit
+    int find_best_following_suit_card(CardSet following, Suit trump) const;
+
+    // Helper method to find the lowest non-trump card
+    int find_lowest_non_trump_card(Suit trump) const;
+
+    // Helper method to find the lowest trump card that's not a bower
+    int find_lowest_non_bower_trump(Suit trump) const;
+
+    // Helper method to find the highest non-trump card
+    int find_highest_non_trump_card(Suit trump) const;
+
+    // Helper method to find special bower cards
+    int find_bower(Suit trump, bool right_bower) const;
+
+    // Helper method to find the highest trump card
+    int find_highest_trump_card(Suit trump) const;
+
+    // Helper method to remove the card at a CardSet index from the hand
+    Card remove_card(int index);
+};
+
+
+/////////////// Inline implementation ///////////////
+
+// Helper methods return the CardSet index of the card they find, or -1
+inline Simple::Simple(const std::string &name_in) : name(name_in) {}
+
+inline const std::string & Simple::get_name() const {
+    return name;
+}
+
+inline void Simple::add_card(const Card &c) {
+    hand.insert(c);
+}
+
+inline bool Simple::make_trump(const Card &upcard, bool is_dealer,
+    int round, Suit &order_up_suit) const {
+    if (hand.empty()) {
+        return false;
+    }
+
+    // A full hand is one lookup in the precomputed table
+    if (hand.size() == BID_TABLE_HAND_SIZE) {
+        Suit upcard_suit = upcard.get_suit();
+        if (!simple_orders_up(hand, upcard_suit, is_dealer, round)) {
+            return false;
+        }
+        order_up_suit = round == 1 ? upcard_suit : Suit_next(upcard_suit);
+        return true;
+    }
+    
+    CardSet faces = hand & CardSet::face_or_ace();
+    
+    if (round == 1) {
+        // In round 1, count face cards in upcard's suit (left bower included)
+        Suit trump = upcard.get_suit();
+        if (faces.count(trump, trump) >= 2) {
+            order_up_suit = trump;
+            return true;
+        }
+    } else {
+        Suit next = Suit_next(upcard.get_suit());
+        if (faces.count(next, next) >= 1 || is_dealer) {
+            order_up_suit = next;
+            return true;
+        }
+    }
+    return false;
+}
+
+inline void Simple::add_and_discard(const Card &upcard) {
+    hand.insert(upcard);
+    //try to discard the lowest non-trump card
+    CardSet non_trump = hand - CardSet::trump_cards(upcard.get_suit());
+    if (!non_trump.empty()) {
+        hand.erase(non_trump.lowest());
+        return;
+    }
+    // If all cards are trump, discard the lowest trump.
+    hand.erase(hand.lowest());
+}
+
+//When a Simple Player leads a trick, they play the highest non-trump card in their hand
+//If they have only trump cards, they play the highest trump card in their hand.
+inline Card Simple::lead_card(Suit trump) {
+    // First try to find highest non-trump card
+    int index = find_highest_non_trump_card(trump);
+    // Then the right bower, the left bower and the highest other trump
+    if (index == -1) {
+        index = find_bower(trump, true);
+    }
+    if (index == -1) {
+        index = find_bower(trump, false);
+    }
+    if (index == -1) {
+        index = find_highest_trump_card(trump);
+    }
+    return remove_card(index);
+}
+
+// Helper method to find cards that follow the led suit
+inline CardSet Simple::find_following_suit_cards(const Card &led_card, 
+Suit trump) const {
+    return hand & CardSet::of_suit(led_card.get_suit(trump), trump);
+}
+
+// Helper method to find the best card among those that follow suit.
+// Bowers only follow suit when trump is led, and they outrank the rest.
+inline int Simple::find_best_following_suit_card(CardSet following, 
+Suit trump) const {
+    return CardSet::index_of(following.highest(trump));
+}
+
+// Helper method to find the lowest non-trump card
+inline int Simple::find_lowest_non_trump_card(Suit trump) const {
+    CardSet non_trump = hand - CardSet::trump_cards(trump);
+    if (non_trump.empty()) {
+        return -1;
+    }
+    return CardSet::index_of(non_trump.lowest());
+}
+
+// Helper method to find the lowest trump card that's not a bower
+inline int Simple::find_lowest_non_bower_trump(Suit trump) const {
+    CardSet trump_cards = hand & CardSet::trump_cards(trump);
+    trump_cards.erase(Card(JACK, trump));
+    trump_cards.erase(Card(JACK, Suit_next(trump)));
+    if (trump_cards.empty()) {
+        return -1;
+    }
+    return CardSet::index_of(trump_cards.lowest());
+}
+
+inline Card Simple::play_card(const Card &led_card, Suit trump) {
+    // Find cards that follow suit
+    CardSet following = find_following_suit_cards(led_card, trump);
+    
+    // If we found cards that follow suit, determine the best one
+    if (!following.empty()) {
+        return remove_card(find_best_following_suit_card(following, trump));
+    }
+
+    // If cannot follow suit, try to play the lowest non-trump card
+    int index = find_lowest_non_trump_card(trump);
+    // Then the lowest non-bower trump, the left bower and the right bower
+    if (index == -1) {
+        index = find_lowest_non_bower_trump(trump);
+    }
+    if (index == -1) {
+        index = find_bower(trump, false);
+    }
+    if (index == -1) {
+        index = find_bower(trump, true);
+    }
+    return remove_card(index);
+}
+
+// Helper method to find the highest non-trump card
+inline int Simple::find_highest_non_trump_card(Suit trump) const {
+    CardSet non_trump = hand - CardSet::trump_cards(trump);
+    if (non_trump.empty()) {
+        return -1;  // No non-trump cards found
+    }
+    return CardSet::index_of(non_trump.highest());
+}
+
+// Helper method to find special bower cards
+inline int Simple::find_bower(Suit trump, bool right_bower) const {
+    Card bower(JACK, right_bower ? trump : Suit_next(trump));
+    if (hand.contains(bower)) {
+        return CardSet::index_of(bower);
+    }
+    return -1;  // Bower not found
+}
+
+// Helper method to find the highest trump card
+inline int Simple::find_highest_trump_card(Suit trump) const {
+    CardSet trump_cards = hand & CardSet::trump_cards(trump);
+    if (trump_cards.empty()) {
+        return -1;
+    }
+    return CardSet::index_of(trump_cards.highest(trump));
+}
+
+inline Card Simple::remove_card(int index) {
+    assert(index != -1);
+    Card card_to_play = CardSet::card_at(index);
+    hand.erase(card_to_play);
+    return card_to_play;
+}
+
+#endif // SIMPLE_HPP
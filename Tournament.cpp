@@ -0,0 +1,219 @@
+#include "Tournament.hpp"
+#include "Arena.hpp"
+#include "Player.hpp"
+#include "Simple.hpp"
+#include <algorithm>
+#include <cassert>
+#include <iostream>
+#include <memory>
+#include <mutex>
+#include <sstream>
+#include <thread>
+
+using namespace std;
+
+namespace {
+
+// Number of games a worker claims from its own queue at a time
+const long long CHUNK_SIZE = 64;
+
+// The games still pending on one worker, [next, end).  The owner takes
+// chunks from the front and thieves take the back half.
+struct WorkQueue {
+  mutex lock;
+  long long next = 0;
+  long long end = 0;
+};
+
+// EFFECTS: Claims up to CHUNK_SIZE games from the front of queue, returns
+//          false if it was empty
+bool take(WorkQueue &queue, long long &begin, long long &end) {
+  lock_guard<mutex> guard(queue.lock);
+  if (queue.next >= queue.end) {
+    return false;
+  }
+  begin = queue.next;
+  end = min(queue.end, begin + CHUNK_SIZE);
+  queue.next = end;
+  return true;
+}
+
+// REQUIRES: thief's queue is empty
+// EFFECTS: Moves the back half of victim's pending games to thief, returns
+//          false if victim had nothing left
+bool steal(WorkQueue &victim, WorkQueue &thief) {
+  long long begin;
+  long long end;
+  {
+    lock_guard<mutex> guard(victim.lock);
+    long long remaining = victim.end - victim.next;
+    if (remaining <= 0) {
+      return false;
+    }
+    end = victim.end;
+    begin = end - (remaining + 1) / 2;
+    victim.end = begin;
+  }
+  lock_guard<mutex> guard(thief.lock);
+  thief.next = begin;
+  thief.end = end;
+  return true;
+}
+
+// The log of games [first_game, first_game + n) as GameLog::write writes
+// them, one game after another
+struct LoggedChunk {
+  long long first_game;
+  string bytes;
+};
+
+// Everything one worker thread needs, none of it shared.  Aligned to a
+// cache line so workers never write to the same line.
+struct alignas(64) Worker {
+  // The worker's own copy of the pack, and of the setting whose stream
+  // changes with every game.  Its cycle is shared by every worker.
+  GameSetup setup;
+  // The players live in the worker's own arena, next to each other
+  Arena arena;
+  vector<Player*> players;
+  // The same players, if all four are Simple, so games can be BotGames
+  vector<Simple*> simple_players;
+  GameTotals totals;
+  GameStats stats;
+  // Set if the games are logged, into the worker's own chunks
+  bool log_games = false;
+  GameLog game_log;
+  vector<LoggedChunk> logged;
+};
+
+// EFFECTS: Plays games [begin, end) between seats with worker's own setup
+template <typename Seats>
+void play_games(Worker &worker, const Seats &seats, long long begin,
+                long long end) {
+  NullSink discard;
+  ostringstream chunk_log;
+  for (long long game_index = begin; game_index < end; ++game_index) {
+    worker.setup.shuffle.stream = game_index;
+    BasicGame<Seats> game(worker.setup, seats, discard);
+    if (worker.log_games) {
+      game.set_log(&worker.game_log);
+    }
+    GameResult result = game.play();
+    worker.totals.add(result);
+    worker.stats.add(result);
+    if (worker.log_games) {
+      worker.game_log.write(chunk_log);
+    }
+  }
+  if (worker.log_games) {
+    worker.logged.push_back({ begin, chunk_log.str() });
+  }
+}
+
+// EFFECTS: Plays games [begin, end) with worker's own setup and players
+void play_games(Worker &worker, long long begin, long long end) {
+  if (worker.simple_players.size() == 4) {
+    vector<Simple*> &simple = worker.simple_players;
+    BotSeats<Simple> seats(*simple[0], *simple[1], *simple[2], *simple[3]);
+    play_games(worker, seats, begin, end);
+  } else {
+    play_games(worker, worker.players, begin, end);
+  }
+}
+
+// EFFECTS: Plays the games in queues[id], then steals from the other
+//          queues until every queue is empty
+void work(int id, vector<WorkQueue> &queues, Worker &worker) {
+  int num_queues = queues.size();
+  while (true) {
+    long long begin;
+    long long end;
+    if (take(queues[id], begin, end)) {
+      play_games(worker, begin, end);
+      continue;
+    }
+    bool stole = false;
+    for (int i = 1; i < num_queues && !stole; ++i) {
+      stole = steal(queues[(id + i) % num_queues], queues[id]);
+    }
+    // No work is ever added, so once every queue is empty we are done
+    if (!stole) {
+      return;
+    }
+  }
+}
+
+} // namespace
+
+Tournament::Tournament(const GameSetup &setup_in,
+                       const vector<string> &names_in,
+                       const vector<string> &strategies_in)
+  : setup(setup_in), names(names_in), strategies(strategies_in),
+    log(nullptr) {
+  assert(names.size() == 4 && strategies.size() == 4);
+}
+
+void Tournament::set_log(ostream *log_in) {
+  log = log_in;
+}
+
+GameTotals Tournament::run(long long num_games, int num_threads,
+                           GameStats *stats) const {
+  assert(num_games >= 0 && num_threads >= 1);
+  vector<WorkQueue> queues(num_threads);
+  vector<Worker> workers(num_threads);
+  // Every game deals the same cycle of packs, so it is worked out once
+  unique_ptr<ShuffleCycle> cycle;
+  if (setup.shuffle.mode == ShuffleSetting::IN_SHUFFLE && !setup.cycle) {
+    cycle.reset(new ShuffleCycle(setup.pack));
+  }
+  for (int i = 0; i < num_threads; ++i) {
+    queues[i].next = num_games * i / num_threads;
+    queues[i].end = num_games * (i + 1) / num_threads;
+    workers[i].setup = setup;
+    if (cycle) {
+      workers[i].setup.cycle = cycle.get();
+    }
+    workers[i].log_games = log != nullptr;
+    for (int seat = 0; seat < 4; ++seat) {
+      Player *player = Player_factory(names[seat], strategies[seat],
+                                      workers[i].arena);
+      workers[i].players.push_back(player);
+      Simple *simple = dynamic_cast<Simple*>(player);
+      if (simple) {
+        workers[i].simple_players.push_back(simple);
+      }
+    }
+  }
+
+  vector<thread> threads;
+  for (int i = 1; i < num_threads; ++i) {
+    threads.emplace_back(work, i, ref(queues), ref(workers[i]));
+  }
+  work(0, queues, workers[0]);
+  for (thread &t : threads) {
+    t.join();
+  }
+
+  GameTotals totals;
+  vector<LoggedChunk> logged;
+  for (Worker &worker : workers) {
+    totals.merge(worker.totals);
+    if (stats) {
+      stats->merge(worker.stats);
+    }
+    for (LoggedChunk &chunk : worker.logged) {
+      logged.push_back(move(chunk));
+    }
+    worker.arena.reset();
+  }
+  // Stolen chunks finish out of order, so put the games back in order
+  sort(logged.begin(), logged.end(),
+       [](const LoggedChunk &lhs, const LoggedChunk &rhs) {
+         return lhs.first_game < rhs.first_game;
+       });
+  for (const LoggedChunk &chunk : logged) {
+    log->write(chunk.bytes.data(), chunk.bytes.size());
+  }
+  return totals;
+}
@@ -0,0 +1,61 @@
+#ifndef TOURNAMENT_HPP
+#define TOURNAMENT_HPP
+/* Tournament.hpp
+ *
+ * Plays many independent games of euchre across several threads.
+ *
+ * Every worker thread owns its own Pack and Players, and plays all of its
+ * games with them; the Players sit together in the worker's own Arena.
+ * Game indices are split evenly between the workers up front; a worker
+ * plays its games in small chunks, and a worker that runs out steals half
+ * of the games still pending on another worker.  Each worker keeps its own
+ * GameTotals and GameStats, and they are merged once all threads have
+ * finished, so workers share no counters.
+ * Tables of four Simple players are played as BotGames.
+ *
+ * A run can also log every game it plays.  Each worker logs its chunks of
+ * games into its own buffers, and they are written out in game order once
+ * the threads have finished, so a logged run holds its whole log in memory,
+ * about GameLog::HAND_RECORD_BYTES per hand.
+ */
+
+#include "Game.hpp"
+#include "GameStats.hpp"
+#include "Pack.hpp"
+#include <iostream>
+#include <string>
+#include <vector>
+
+class Tournament {
+public:
+  // REQUIRES: names and strategies have four entries, in seat order, and
+  //           no strategy reads from cin (Human players are not allowed)
+  // EFFECTS: Initializes a tournament whose games are set up as setup.  If
+  //          setup has no cycle, an IN_SHUFFLE run works one out for itself.
+  // NOTE: With a RANDOM shuffle, game k of a run uses random stream k, so
+  //       results do not depend on the number of threads.
+  Tournament(const GameSetup &setup_in, const std::vector<std::string> &names,
+             const std::vector<std::string> &strategies);
+
+  // REQUIRES: num_games >= 0, num_threads >= 1
+  // MODIFIES: stats
+  // EFFECTS: Plays num_games games on num_threads threads and returns the
+  //          combined totals.  If stats is not nullptr, every game is also
+  //          added to it.
+  GameTotals run(long long num_games, int num_threads,
+                 GameStats *stats = nullptr) const;
+
+  // MODIFIES: log_in
+  // EFFECTS: Makes run() write every game it plays to log_in, in game order,
+  //          one GameLog after another as GameLog::write writes them.  Pass
+  //          nullptr to stop logging.
+  void set_log(std::ostream *log_in);
+
+private:
+  GameSetup setup;
+  std::vector<std::string> names;
+  std::vector<std::string> strategies;
+  std::ostream *log;
+};
+
+#endif // TOURNAMENT_HPP
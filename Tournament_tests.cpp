@@ -0,0 +1,90 @@
+#include "Tournament.hpp"
+#include "unit_test_framework.hpp"
+#include <iostream>
+#include <sstream>
+#include <string>
+#include <vector>
+
+using namespace std;
+
+const vector<string> NAMES = { "Adi", "Barbara", "Chi-Chih", "Dabbala" };
+const vector<string> SIMPLE = { "Simple", "Simple", "Simple", "Simple" };
+const ShuffleSetting NO_SHUFFLE = { ShuffleSetting::NO_SHUFFLE, 0, 0 };
+const ShuffleSetting IN_SHUFFLE = { ShuffleSetting::IN_SHUFFLE, 0, 0 };
+const ShuffleSetting RANDOM = { ShuffleSetting::RANDOM, 280, 0 };
+
+//every game is played exactly once
+TEST(test_tournament_game_count) {
+    Tournament tournament({ Pack(), IN_SHUFFLE, 5 }, NAMES, SIMPLE);
+    GameTotals totals = tournament.run(1000, 4);
+    ASSERT_EQUAL(1000, totals.get_games());
+    ASSERT_EQUAL(1000, totals.get_wins(0) + totals.get_wins(1));
+}
+//thread count does not change the results
+TEST(test_tournament_threads_agree) {
+    Tournament tournament({ Pack(), RANDOM, 10 }, NAMES, SIMPLE);
+    GameTotals one = tournament.run(300, 1);
+    GameTotals many = tournament.run(300, 7);
+    ASSERT_EQUAL(one.get_games(), many.get_games());
+    ASSERT_EQUAL(one.get_wins(0), many.get_wins(0));
+    ASSERT_EQUAL(one.get_euchres(), many.get_euchres());
+    ASSERT_EQUAL(one.get_marches(), many.get_marches());
+    ASSERT_EQUAL(one.get_average_hands(), many.get_average_hands());
+}
+//more threads than games
+TEST(test_tournament_few_games) {
+    Tournament tournament({ Pack(), NO_SHUFFLE, 1 }, NAMES, SIMPLE);
+    ASSERT_EQUAL(3, tournament.run(3, 8).get_games());
+    ASSERT_EQUAL(0, tournament.run(0, 2).get_games());
+}
+//a logged run holds every game in order, whatever the thread count, and
+//each game is the one a lone Game with its stream plays
+TEST(test_tournament_log) {
+    Tournament tournament({ Pack(), RANDOM, 10 }, NAMES, SIMPLE);
+    ostringstream one;
+    ostringstream many;
+    tournament.set_log(&one);
+    tournament.run(200, 1);
+    tournament.set_log(&many);
+    GameTotals totals = tournament.run(200, 5);
+    ASSERT_EQUAL(one.str(), many.str());
+
+    vector<Player*> players;
+    for (const string &name : NAMES) {
+        players.push_back(Player_factory(name, "Simple"));
+    }
+    istringstream in(many.str());
+    GameLog read_log;
+    int games = 0;
+    long long hands = 0;
+    for (; read_log.read(in); ++games) {
+        hands += read_log.num_hands();
+        if (games % 50 == 0) {
+            ShuffleSetting shuffle = RANDOM;
+            shuffle.stream = games;
+            NullSink out;
+            Game game({ Pack(), shuffle, 10 }, players, out);
+            GameLog log;
+            game.set_log(&log);
+            game.play();
+            ostringstream expected;
+            ostringstream actual;
+            log.write(expected);
+            read_log.write(actual);
+            ASSERT_EQUAL(expected.str(), actual.str());
+        }
+    }
+    ASSERT_EQUAL(200, games);
+    ASSERT_ALMOST_EQUAL(totals.get_average_hands() * 200,
+                        static_cast<double>(hands), 1e-6);
+    for (Player *player : players) {
+        delete player;
+    }
+
+    size_t logged = many.str().size();
+    tournament.set_log(nullptr);
+    tournament.run(10, 2);
+    ASSERT_EQUAL(logged, many.str().size());
+}
+
+TEST_MAIN()
@@ -0,0 +1,180 @@
+#ifndef TRUMPORDER_HPP
+#define TRUMPORDER_HPP
+/* TrumpOrder.hpp
+ *
+ * Precomputed trump-order strength of every card for every trump suit.
+ * Comparing two strengths gives the same answer as Card_less(a, b, trump),
+ * so a comparison is two table lookups and an integer compare, and hands can
+ * be sorted in trump order by sorting plain integers.
+ *
+ * Trump order, from lowest to highest:
+ *   non-trump cards, ordered by rank and then suit (operator<)
+ *   trump cards other than the bowers, ordered by rank
+ *   the left bower
+ *   the right bower
+ *
+ * Trick order also depends on the suit led, and is what decides who takes a
+ * trick.  From lowest to highest:
+ *   cards that neither follow the led suit nor are trump, ordered by
+ *     rank and then suit (operator<)
+ *   non-trump cards of the led suit, ordered by rank
+ *   trump cards, in trump order
+ */
+
+#include "Card.hpp"
+#include "PackedCard.hpp"
+#include <array>
+#include <cstdint>
+
+namespace trump_order_detail {
+  const int NUM_SUITS = 4;
+  const int NUM_RANKS = ACE + 1;
+  const int NUM_CARDS = NUM_SUITS * NUM_RANKS;
+
+  // Strengths of the three bands above the non-trump cards
+  const int TRUMP_BASE = NUM_CARDS;
+  const int LEFT_BOWER = TRUMP_BASE + NUM_RANKS;
+  const int RIGHT_BOWER = LEFT_BOWER + 1;
+
+  // In trick order the led suit gets its own band below trump, so trump
+  // strengths are shifted up by the size of that band
+  const int LED_BASE = NUM_CARDS;
+  const int TRICK_TRUMP_SHIFT = NUM_RANKS;
+
+  // Card tables are indexed by suit * NUM_RANKS + rank, so they also cover
+  // the non-euchre ranks that Card can represent
+  typedef std::array<std::array<uint8_t, NUM_CARDS>, NUM_SUITS> CardTable;
+  typedef std::array<std::array<uint8_t, PackedCard::NUM_CARDS>, NUM_SUITS>
+    PackedTable;
+  // Trick tables are indexed by [trump][effective led suit][card]
+  typedef std::array<CardTable, NUM_SUITS> CardTrickTable;
+  typedef std::array<PackedTable, NUM_SUITS> PackedTrickTable;
+
+  constexpr int strength(Rank rank, Suit suit, Suit trump) {
+    if (rank == JACK && suit == trump) {
+      return RIGHT_BOWER;
+    }
+    if (rank == JACK && suit == PackedCard::next_suit(trump)) {
+      return LEFT_BOWER;
+    }
+    if (suit == trump) {
+      return TRUMP_BASE + rank;
+    }
+    return rank * NUM_SUITS + suit;
+  }
+
+  constexpr int trick_strength(Rank rank, Suit suit, Suit led_suit,
+                               Suit trump) {
+    int in_trump_order = strength(rank, suit, trump);
+    if (in_trump_order >= TRUMP_BASE) {
+      return in_trump_order + TRICK_TRUMP_SHIFT;
+    }
+    if (suit == led_suit) {
+      return LED_BASE + rank;
+    }
+    return in_trump_order;
+  }
+
+  constexpr CardTable make_card_table() {
+    CardTable table = {};
+    for (int t = 0; t < NUM_SUITS; ++t) {
+      for (int s = 0; s < NUM_SUITS; ++s) {
+        for (int r = 0; r < NUM_RANKS; ++r) {
+          table[t][s * NUM_RANKS + r] = static_cast<uint8_t>(strength(
+            static_cast<Rank>(r), static_cast<Suit>(s), static_cast<Suit>(t)));
+        }
+      }
+    }
+    return table;
+  }
+
+  constexpr PackedTable make_packed_table() {
+    PackedTable table = {};
+    for (int t = 0; t < NUM_SUITS; ++t) {
+      for (int i = 0; i < PackedCard::NUM_CARDS; ++i) {
+        PackedCard card(i);
+        table[t][i] = static_cast<uint8_t>(
+          strength(card.get_rank(), card.get_suit(), static_cast<Suit>(t)));
+      }
+    }
+    return table;
+  }
+
+  constexpr CardTrickTable make_card_trick_table() {
+    CardTrickTable table = {};
+    for (int t = 0; t < NUM_SUITS; ++t) {
+      for (int l = 0; l < NUM_SUITS; ++l) {
+        for (int s = 0; s < NUM_SUITS; ++s) {
+          for (int r = 0; r < NUM_RANKS; ++r) {
+            table[t][l][s * NUM_RANKS + r] = static_cast<uint8_t>(
+              trick_strength(static_cast<Rank>(r), static_cast<Suit>(s),
+                             static_cast<Suit>(l), static_cast<Suit>(t)));
+          }
+        }
+      }
+    }
+    return table;
+  }
+
+  constexpr PackedTrickTable make_packed_trick_table() {
+    PackedTrickTable table = {};
+    for (int t = 0; t < NUM_SUITS; ++t) {
+      for (int l = 0; l < NUM_SUITS; ++l) {
+        for (int i = 0; i < PackedCard::NUM_CARDS; ++i) {
+          PackedCard card(i);
+          table[t][l][i] = static_cast<uint8_t>(
+            trick_strength(card.get_rank(), card.get_suit(),
+                           static_cast<Suit>(l), static_cast<Suit>(t)));
+        }
+      }
+    }
+    return table;
+  }
+
+  inline constexpr CardTable CARD_STRENGTH = make_card_table();
+  inline constexpr PackedTable PACKED_STRENGTH = make_packed_table();
+  inline constexpr CardTrickTable CARD_TRICK_STRENGTH = make_card_trick_table();
+  inline constexpr PackedTrickTable PACKED_TRICK_STRENGTH =
+    make_packed_trick_table();
+}
+
+//EFFECTS Returns the strength of the card with rank and suit in trump order.
+//  a is lower than b in trump order exactly when its strength is smaller.
+constexpr int trump_strength(Rank rank, Suit suit, Suit trump) {
+  return trump_order_detail::strength(rank, suit, trump);
+}
+
+//EFFECTS Returns the strength of card in trump order, by table lookup
+inline int trump_strength(const Card &card, Suit trump) {
+  return trump_order_detail::CARD_STRENGTH[trump]
+    [card.get_suit() * trump_order_detail::NUM_RANKS + card.get_rank()];
+}
+
+//EFFECTS Returns the strength of card in trump order, by table lookup
+constexpr int trump_strength(PackedCard card, Suit trump) {
+  return trump_order_detail::PACKED_STRENGTH[trump][card.index()];
+}
+
+//REQUIRES led_suit is the suit of the led card when trump is trump, that
+//  is led_card.get_suit(trump)
+//EFFECTS Returns the strength of the card with rank and suit in trick order.
+//  The card with the highest strength takes the trick.
+constexpr int trick_strength(Rank rank, Suit suit, Suit led_suit, Suit trump) {
+  return trump_order_detail::trick_strength(rank, suit, led_suit, trump);
+}
+
+//REQUIRES led_suit is led_card.get_suit(trump)
+//EFFECTS Returns the strength of card in trick order, by table lookup
+inline int trick_strength(const Card &card, Suit led_suit, Suit trump) {
+  return trump_order_detail::CARD_TRICK_STRENGTH[trump][led_suit]
+    [card.get_suit() * trump_order_detail::NUM_RANKS + card.get_rank()];
+}
+
+//REQUIRES led_suit is led_card.get_suit(trump)
+//EFFECTS Returns the strength of card in trick order, by table lookup
+constexpr int trick_strength(PackedCard card, Suit led_suit, Suit trump) {
+  return trump_order_detail::PACKED_TRICK_STRENGTH[trump][led_suit]
+    [card.index()];
+}
+
+#endif // TRUMPORDER_HPP
@@ -0,0 +1,116 @@
+#include "TrumpOrder.hpp"
+#include "unit_test_framework.hpp"
+#include <algorithm>
+#include <iostream>
+#include <vector>
+
+using namespace std;
+
+static_assert(trump_strength(PackedCard(JACK, HEARTS), HEARTS) >
+              trump_strength(PackedCard(JACK, DIAMONDS), HEARTS),
+              "right bower beats left bower");
+
+//bowers and trump
+TEST(test_strength_bowers) {
+    Suit trump = SPADES;
+    int right = trump_strength(Card(JACK, SPADES), trump);
+    int left = trump_strength(Card(JACK, CLUBS), trump);
+    int ace = trump_strength(Card(ACE, SPADES), trump);
+    int off_ace = trump_strength(Card(ACE, HEARTS), trump);
+    ASSERT_TRUE(left < right);
+    ASSERT_TRUE(ace < left);
+    ASSERT_TRUE(off_ace < ace);
+    ASSERT_TRUE(trump_strength(Card(TWO, SPADES), trump) > off_ace);
+}
+//non-trump cards follow operator<
+TEST(test_strength_non_trump) {
+    Suit trump = CLUBS;
+    Card a(KING, HEARTS);
+    Card b(KING, DIAMONDS);
+    Card c(ACE, HEARTS);
+    ASSERT_TRUE(trump_strength(a, trump) < trump_strength(b, trump));
+    ASSERT_TRUE(trump_strength(b, trump) < trump_strength(c, trump));
+}
+//packed and Card tables agree
+TEST(test_strength_packed_matches_card) {
+    for (int t = SPADES; t <= DIAMONDS; ++t) {
+        Suit trump = static_cast<Suit>(t);
+        for (int i = 0; i < PackedCard::NUM_CARDS; ++i) {
+            PackedCard packed(i);
+            ASSERT_EQUAL(trump_strength(packed.to_card(), trump),
+                         trump_strength(packed, trump));
+        }
+    }
+}
+//table agrees with Card_less
+TEST(test_strength_matches_card_less) {
+    for (int t = SPADES; t <= DIAMONDS; ++t) {
+        Suit trump = static_cast<Suit>(t);
+        for (int i = 0; i < PackedCard::NUM_CARDS; ++i) {
+            for (int j = 0; j < PackedCard::NUM_CARDS; ++j) {
+                Card a = PackedCard(i).to_card();
+                Card b = PackedCard(j).to_card();
+                bool less = trump_strength(a, trump) < trump_strength(b, trump);
+                ASSERT_EQUAL(Card_less(a, b, trump), less);
+            }
+        }
+    }
+}
+//integer sort gives trump order
+TEST(test_strength_sort) {
+    Suit trump = HEARTS;
+    vector<int> hand = { trump_strength(Card(JACK, HEARTS), trump),
+                         trump_strength(Card(NINE, CLUBS), trump),
+                         trump_strength(Card(JACK, DIAMONDS), trump),
+                         trump_strength(Card(ACE, HEARTS), trump) };
+    sort(hand.begin(), hand.end());
+    ASSERT_EQUAL(trump_strength(Card(NINE, CLUBS), trump), hand[0]);
+    ASSERT_EQUAL(trump_strength(Card(ACE, HEARTS), trump), hand[1]);
+    ASSERT_EQUAL(trump_strength(Card(JACK, DIAMONDS), trump), hand[2]);
+    ASSERT_EQUAL(trump_strength(Card(JACK, HEARTS), trump), hand[3]);
+}
+//trick order
+TEST(test_trick_strength_led_suit) {
+    Suit trump = CLUBS;
+    Suit led = DIAMONDS;
+    int led_nine = trick_strength(Card(NINE, DIAMONDS), led, trump);
+    ASSERT_TRUE(trick_strength(Card(ACE, HEARTS), led, trump) < led_nine);
+    ASSERT_TRUE(led_nine < trick_strength(Card(ACE, DIAMONDS), led, trump));
+    ASSERT_TRUE(trick_strength(Card(ACE, DIAMONDS), led, trump) <
+                trick_strength(Card(NINE, CLUBS), led, trump));
+    ASSERT_TRUE(trick_strength(Card(NINE, CLUBS), led, trump) <
+                trick_strength(Card(JACK, SPADES), led, trump));
+}
+//left bower follows trump, not its printed suit
+TEST(test_trick_strength_left_bower_led) {
+    Suit trump = HEARTS;
+    Card left(JACK, DIAMONDS);
+    Suit led = left.get_suit(trump);
+    ASSERT_EQUAL(HEARTS, led);
+    ASSERT_TRUE(trick_strength(Card(ACE, DIAMONDS), led, trump) <
+                trick_strength(Card(NINE, HEARTS), led, trump));
+    ASSERT_TRUE(trick_strength(Card(ACE, HEARTS), led, trump) <
+                trick_strength(left, led, trump));
+}
+//table agrees with the led-card Card_less and the PackedCard table
+TEST(test_trick_strength_matches_card_less) {
+    for (int t = SPADES; t <= DIAMONDS; ++t) {
+        Suit trump = static_cast<Suit>(t);
+        for (int l = 0; l < PackedCard::NUM_CARDS; ++l) {
+            Card led_card = PackedCard(l).to_card();
+            Suit led = led_card.get_suit(trump);
+            for (int i = 0; i < PackedCard::NUM_CARDS; ++i) {
+                Card a = PackedCard(i).to_card();
+                int strength = trick_strength(a, led, trump);
+                ASSERT_EQUAL(strength, trick_strength(PackedCard(i), led, trump));
+                for (int j = 0; j < PackedCard::NUM_CARDS; ++j) {
+                    Card b = PackedCard(j).to_card();
+                    bool less = strength < trick_strength(b, led, trump);
+                    ASSERT_EQUAL(Card_less(a, b, led_card, trump), less);
+                }
+            }
+        }
+    }
+}
+
+TEST_MAIN()
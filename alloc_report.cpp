@@ -0,0 +1,100 @@
+#include "AllocationTracker.hpp"
+#include "Game.hpp"
+#include "Player.hpp"
+#include <cstdlib>
+#include <iomanip>
+#include <iostream>
+#include <string>
+#include <vector>
+using namespace std;
+
+string usage =
+  "Usage: alloc_report.exe NUM_GAMES TYPE1 TYPE2 TYPE3 TYPE4 [SEED]";
+
+const int POINTS_TO_WIN = 10;
+
+// What was allocated in each bucket while the games were played, copied
+// before printing the report allocates anything
+AllocationCount counts[NUM_ALLOCATION_BUCKETS];
+
+//Prints one line of the report: what was allocated in buckets, in total,
+//per game and per hand
+void print_line(const string &label,
+                const vector<AllocationBucket> &buckets,
+                long long games, long long hands) {
+  AllocationCount total = { 0, 0 };
+  for (AllocationBucket bucket : buckets) {
+    const AllocationCount &count = counts[bucket];
+    total.allocations += count.allocations;
+    total.bytes += count.bytes;
+  }
+  cout << left << setw(28) << label << right
+       << setw(12) << total.allocations << setw(14) << total.bytes
+       << fixed << setprecision(2)
+       << setw(12) << static_cast<double>(total.allocations) / games
+       << setw(12) << static_cast<double>(total.allocations) / hands
+       << setw(12) << static_cast<double>(total.bytes) / hands << '\n';
+}
+
+//Prints a group of buckets, then each bucket of it on its own
+void print_group(const string &label,
+                 const vector<AllocationBucket> &buckets,
+                 long long games, long long hands) {
+  print_line(label, buckets, games, hands);
+  for (AllocationBucket bucket : buckets) {
+    print_line(string("  ") + allocation_bucket_name(bucket), { bucket },
+               games, hands);
+  }
+}
+
+//Plays NUM_GAMES games of the given strategies without a transcript,
+//shuffled at random, and prints every heap allocation made while playing
+//them by where it was made.  Must be built with TRACK_ALLOCATIONS.
+int main(int argc, char **argv) {
+  if (argc < 6 || argc > 7 || atoll(argv[1]) < 1) {
+    cout << usage << endl;
+    return 1;
+  }
+  long long num_games = atoll(argv[1]);
+  vector<Player*> players;
+  for (int i = 2; i < 6; ++i) {
+    if (!Player_strategy_exists(argv[i]) || string(argv[i]) == "Human") {
+      cout << usage << endl;
+      return 1;
+    }
+    players.push_back(Player_factory("Player " + to_string(i - 1), argv[i]));
+  }
+  ShuffleSetting shuffle = { ShuffleSetting::RANDOM, 0, 0 };
+  shuffle.seed = argc == 7 ? strtoull(argv[6], nullptr, 10) : 0;
+
+  NullSink discard;
+  long long hands = 0;
+  reset_allocation_counts();
+  for (long long game_index = 0; game_index < num_games; ++game_index) {
+    ALLOCATION_SCOPE(ALLOC_GAME);
+    shuffle.stream = game_index;
+    Game game({ Pack(), shuffle, POINTS_TO_WIN }, players, discard);
+    hands += game.play().hands;
+  }
+  for (int bucket = 0; bucket < NUM_ALLOCATION_BUCKETS; ++bucket) {
+    counts[bucket] = allocation_count(static_cast<AllocationBucket>(bucket));
+  }
+
+  cout << num_games << " games, " << hands << " hands\n";
+  cout << left << setw(28) << "where" << right << setw(12) << "allocs"
+       << setw(14) << "bytes" << setw(12) << "allocs/game"
+       << setw(12) << "allocs/hand" << setw(12) << "bytes/hand" << '\n';
+  print_line("Pack", { ALLOC_PACK }, num_games, hands);
+  print_group("Player hand maintenance",
+              { ALLOC_ADD_CARD, ALLOC_ADD_AND_DISCARD }, num_games, hands);
+  print_group("Player decisions",
+              { ALLOC_MAKE_TRUMP, ALLOC_LEAD_CARD, ALLOC_PLAY_CARD },
+              num_games, hands);
+  print_line("Player notifications", { ALLOC_NOTIFY }, num_games, hands);
+  print_line("Game bookkeeping", { ALLOC_GAME }, num_games, hands);
+  print_line("Other", { ALLOC_OTHER }, num_games, hands);
+
+  for (Player *player : players) {
+    delete player;
+  }
+}
@@ -0,0 +1,213 @@
+#include "Card.hpp"
+#include "CardSet.hpp"
+#include "Game.hpp"
+#include "HandRank.hpp"
+#include "Pack.hpp"
+#include "Player.hpp"
+#include "Rng.hpp"
+#include <algorithm>
+#include <chrono>
+#include <cmath>
+#include <iomanip>
+#include <iostream>
+#include <string>
+#include <vector>
+using namespace std;
+
+// Inputs are drawn from tables of this many entries, a power of two, so
+// picking the next one is a mask and branches cannot learn the sequence
+const int NUM_INPUTS = 1 << 12;
+const int INPUT_MASK = NUM_INPUTS - 1;
+
+// Samples thrown away before measuring, and samples measured
+const int WARMUP_SAMPLES = 3;
+const int SAMPLES = 15;
+
+// Each sample runs for about this long
+const double SAMPLE_SECONDS = 0.01;
+
+// Results are folded in here so the compiler cannot drop the work
+volatile unsigned sink;
+
+//Runs op(i) for i = 0, 1, 2, ... in samples of a fixed number of calls,
+//then prints the mean time per call over the samples, their standard
+//deviation and the fastest sample.  op returns a value that depends on
+//its work.
+template <typename Op>
+void bench(const string &name, Op op) {
+  using clock = chrono::steady_clock;
+  // Find a number of calls that takes about SAMPLE_SECONDS
+  long long calls = 1;
+  while (true) {
+    auto start = clock::now();
+    unsigned result = 0;
+    for (long long i = 0; i < calls; ++i) {
+      result += op(i);
+    }
+    sink = sink + result;
+    double seconds = chrono::duration<double>(clock::now() - start).count();
+    if (seconds >= SAMPLE_SECONDS / 4) {
+      calls = max(1LL, static_cast<long long>(calls * SAMPLE_SECONDS /
+                                              seconds));
+      break;
+    }
+    calls *= 2;
+  }
+
+  vector<double> ns_per_call;
+  long long next = 0;
+  for (int sample = 0; sample < WARMUP_SAMPLES + SAMPLES; ++sample) {
+    auto start = clock::now();
+    unsigned result = 0;
+    for (long long end = next + calls; next < end; ++next) {
+      result += op(next);
+    }
+    sink = sink + result;
+    double ns = chrono::duration<double, nano>(clock::now() - start).count();
+    if (sample >= WARMUP_SAMPLES) {
+      ns_per_call.push_back(ns / calls);
+    }
+  }
+
+  double mean = 0;
+  for (double ns : ns_per_call) {
+    mean += ns;
+  }
+  mean /= ns_per_call.size();
+  double variance = 0;
+  for (double ns : ns_per_call) {
+    variance += (ns - mean) * (ns - mean);
+  }
+  variance /= ns_per_call.size() - 1;
+  double fastest = *min_element(ns_per_call.begin(), ns_per_call.end());
+  cout << left << setw(36) << name << right << fixed << setprecision(2)
+       << setw(10) << mean << setw(10) << sqrt(variance)
+       << setw(10) << fastest << '\n';
+}
+
+// A euchre card, or a suit, chosen at random
+Card random_card(CounterRng &rng) {
+  return CardSet::card_at(rng.below(CardSet::NUM_CARDS));
+}
+
+Suit random_suit(CounterRng &rng) {
+  return static_cast<Suit>(rng.below(4));
+}
+
+// A card chosen at random from the cards not in hand, as a card someone
+// else turns up or leads always is
+Card random_card_outside(CounterRng &rng, CardSet hand) {
+  CardSet outside(~hand.bits() & ((1u << CardSet::NUM_CARDS) - 1));
+  return outside.nth(rng.below(outside.size()));
+}
+
+//Times the hot paths of Card, Pack, Simple and Game on random inputs and
+//prints nanoseconds per operation.  Build with optimization: make bench.
+int main() {
+  CounterRng rng(2014, 12);
+  vector<Card> cards_a, cards_b, led_cards;
+  vector<Suit> trumps;
+  for (int i = 0; i < NUM_INPUTS; ++i) {
+    cards_a.push_back(random_card(rng));
+    cards_b.push_back(random_card(rng));
+    led_cards.push_back(random_card(rng));
+    trumps.push_back(random_suit(rng));
+  }
+
+  // Simple players holding random hands, with a random bidding situation
+  // for each, and a led card they may or may not be able to follow.  The
+  // upcard and the led card are never in the player's hand.
+  vector<Player*> players;
+  vector<Card> upcards;
+  vector<Card> leads;
+  vector<int> rounds;
+  vector<bool> dealers;
+  for (int i = 0; i < NUM_INPUTS; ++i) {
+    CardSet hand = hand_unrank(rng.below(num_hands(Player::MAX_HAND_SIZE)),
+                               Player::MAX_HAND_SIZE);
+    Player *player = Player_factory("Simple", "Simple");
+    for (Card card : hand) {
+      player->add_card(card);
+    }
+    players.push_back(player);
+    upcards.push_back(random_card_outside(rng, hand));
+    leads.push_back(random_card_outside(rng, hand));
+    rounds.push_back(1 + rng.below(2));
+    dealers.push_back(rng.below(4) == 0);
+  }
+
+  cout << left << setw(36) << "benchmark" << right << setw(10) << "ns/op"
+       << setw(10) << "stddev" << setw(10) << "min" << '\n';
+
+  bench("Card_less(a, b, trump)", [&](long long i) {
+    int k = i & INPUT_MASK;
+    return Card_less(cards_a[k], cards_b[k], trumps[k]);
+  });
+  bench("Card_less(a, b, led_card, trump)", [&](long long i) {
+    int k = i & INPUT_MASK;
+    return Card_less(cards_a[k], cards_b[k], led_cards[k], trumps[k]);
+  });
+  bench("Card::get_suit(trump)", [&](long long i) {
+    int k = i & INPUT_MASK;
+    return static_cast<unsigned>(cards_a[k].get_suit(trumps[k]));
+  });
+
+  Pack pack;
+  bench("Pack::shuffle()", [&](long long) {
+    pack.shuffle();
+    return static_cast<unsigned>(pack.card_at(0).index());
+  });
+  CounterRng shuffle_rng(2014, 21);
+  bench("Pack::shuffle(rng)", [&](long long) {
+    pack.shuffle(shuffle_rng);
+    return static_cast<unsigned>(pack.card_at(0).index());
+  });
+  bench("Pack::deal_one", [&](long long) {
+    if (pack.empty()) {
+      pack.reset();
+    }
+    return static_cast<unsigned>(pack.deal_one().get_rank());
+  });
+
+  bench("Simple::make_trump", [&](long long i) {
+    int k = i & INPUT_MASK;
+    Suit order_up_suit = SPADES;
+    bool orders = players[k]->make_trump(upcards[k], dealers[k], rounds[k],
+                                         order_up_suit);
+    return orders + static_cast<unsigned>(order_up_suit);
+  });
+  // The card is given back with add_card, so the hand stays at five cards
+  bench("Simple::lead_card + add_card", [&](long long i) {
+    int k = i & INPUT_MASK;
+    Card led = players[k]->lead_card(trumps[k]);
+    players[k]->add_card(led);
+    return static_cast<unsigned>(led.get_suit());
+  });
+  bench("Simple::play_card + add_card", [&](long long i) {
+    int k = i & INPUT_MASK;
+    Card played = players[k]->play_card(leads[k], trumps[k]);
+    players[k]->add_card(played);
+    return static_cast<unsigned>(played.get_suit());
+  });
+
+  // A game to one point is over after one hand: shuffle, deal, bidding,
+  // five tricks and scoring.  Game::play_hand is private, so the time also
+  // covers making the Game, copying its seats included, and play()'s setup.
+  for (Player *player : players) {
+    delete player;
+  }
+  vector<Player*> table;
+  for (int seat = 0; seat < 4; ++seat) {
+    table.push_back(Player_factory("Simple", "Simple"));
+  }
+  NullSink discard;
+  bench("one-hand game, including setup", [&](long long i) {
+    ShuffleSetting shuffle = { ShuffleSetting::RANDOM, 2014,
+                               static_cast<uint64_t>(i) };
+    Game game({ Pack(), shuffle, 1 }, table, discard);
+    return static_cast<unsigned>(game.play().winning_team);
+  });
+  for (Player *player : table) {
+    delete player;
+  }
+}
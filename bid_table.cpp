@@ -0,0 +1,11 @@
+#include "BidTable.hpp"
+#include "OutputSink.hpp"
+using namespace std;
+
+//Prints every 5-card hand with the upcard suits for which a Simple player
+//holding it orders up, in the format of write_simple_bids.
+int main() {
+  StdoutSink out;
+  write_simple_bids(out);
+  out.flush();
+}
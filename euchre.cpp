@@ -2,42 +2,121 @@
 #include "Player.hpp"
 #include "Pack.hpp"
 #include "Card.hpp"
+#include "Game.hpp"
+#include "GameStats.hpp"
+#include "PhaseTimer.hpp"
+#include "Tournament.hpp"
 #include <vector>
 #include <cassert>
+#include <cerrno>
+#include <cstdlib>
 #include <fstream>
+#include <set>
 using namespace std;
 
-class Game{
-  public:
-    Game(const string &pack_filename, bool shuffle_deck, int points, 
-      vector<Player*>& players);
-    void play();
-    const vector<Player*>& get_players() const;
-    
+string err_msg =
+  "Usage: euchre.exe PACK_FILENAME [shuffle|noshuffle|shuffle=random:SEED] ";
+string err_msg2 = "POINTS_TO_WIN NAME1 TYPE1 NAME2 TYPE2 NAME3 TYPE3 NAME4 TYPE4";
+string err_msg3 =
+  " [batch=NUM_GAMES] [threads=NUM_THREADS] [stats] [log=LOG_FILENAME]";
+
+const string BATCH_PREFIX = "batch=";
+const string THREADS_PREFIX = "threads=";
+const string RANDOM_SHUFFLE_PREFIX = "shuffle=random:";
+const string LOG_PREFIX = "log=";
+const string STATS_OPTION = "stats";
+
+//EFFECTS If arg is prefix followed by a number and nothing else, stores
+//  the number in value and returns true
+bool parse_option(const string &arg, const string &prefix, long long &value) {
+  if (arg.compare(0, prefix.size(), prefix) != 0) {
+    return false;
+  }
+  const char *digits = arg.c_str() + prefix.size();
+  char *end = nullptr;
+  errno = 0;
+  value = strtoll(digits, &end, 10);
+  return end != digits && *end == '\0' && errno == 0;
+}
 
-  private:
-    Pack pack;
-    vector<Player*> players;
-    Suit trump;
-    int points_to_win; 
-    int dealer;
-    int hand;
-    vector<int> scores;
-    bool shuffle_deck;
-    int trump_team;
+//EFFECTS Reads the shuffle argument into setting, returns false if it is
+//  not one of shuffle, noshuffle or shuffle=random:SEED
+bool parse_shuffle(const string &arg, ShuffleSetting &setting) {
+  setting.seed = 0;
+  setting.stream = 0;
+  if (arg == "shuffle") {
+    setting.mode = ShuffleSetting::IN_SHUFFLE;
+    return true;
+  }
+  if (arg == "noshuffle") {
+    setting.mode = ShuffleSetting::NO_SHUFFLE;
+    return true;
+  }
+  if (arg.compare(0, RANDOM_SHUFFLE_PREFIX.size(), RANDOM_SHUFFLE_PREFIX) == 0
+      && arg.size() > RANDOM_SHUFFLE_PREFIX.size()) {
+    setting.mode = ShuffleSetting::RANDOM;
+    setting.seed = strtoull(arg.c_str() + RANDOM_SHUFFLE_PREFIX.size(),
+                            nullptr, 10);
+    return true;
+  }
+  return false;
+}
 
-    void set_players(const vector<Player*>& new_players);
-    void shuffle();
-    void deal();
-    void make_trump();
-    void play_hand();
-    void update_scores(const vector<int>& tricks_won);
-    void print_scores();
-    void print_winner();    
+// The options after the players.  num_games is 0 for a single game.
+struct Options {
+  long long num_games;
+  long long num_threads;
+  bool print_stats;
+  string log_filename; // empty if the games are not logged
 };
 
-string err_msg = "Usage: euchre.exe PACK_FILENAME [shuffle|noshuffle] ";
-string err_msg2 = "POINTS_TO_WIN NAME1 TYPE1 NAME2 TYPE2 NAME3 TYPE3 NAME4 TYPE4";
+//EFFECTS Reads the arguments after the players into options, returns false
+//  if one is not an option, has a malformed number or is given twice
+bool parse_options(int argc, char **argv, Options &options) {
+  options = { 0, 1, false, "" };
+  set<string> given;
+  for (int i = 12; i < argc; ++i) {
+    string arg = argv[i];
+    // "stats" or the part of the argument before the '='
+    if (!given.insert(arg.substr(0, arg.find('='))).second) {
+      return false;
+    }
+    if (arg.compare(0, LOG_PREFIX.size(), LOG_PREFIX) == 0) {
+      options.log_filename = arg.substr(LOG_PREFIX.size());
+    } else if (arg == STATS_OPTION) {
+      options.print_stats = true;
+    } else if (!parse_option(arg, BATCH_PREFIX, options.num_games) &&
+               !parse_option(arg, THREADS_PREFIX, options.num_threads)) {
+      return false;
+    }
+  }
+  return true;
+}
+
+//Plays options.num_games games without a transcript on options.num_threads
+//threads, then prints the totals, followed by rates with confidence
+//intervals if options.print_stats is set.  Every game is logged to
+//options.log_filename if it is not empty.
+void play_batch(const GameSetup &setup, const vector<Player*> &players,
+                const vector<string> &types, const Options &options) {
+  vector<string> names;
+  for (Player *player : players) {
+    names.push_back(player->get_name());
+  }
+  Tournament tournament(setup, names, types);
+  ofstream log_file;
+  if (!options.log_filename.empty()) {
+    log_file.open(options.log_filename, ios::binary);
+    tournament.set_log(&log_file);
+  }
+  GameStats stats;
+  GameTotals totals = tournament.run(options.num_games, options.num_threads,
+                                     &stats);
+  totals.print(cout, players);
+  if (options.print_stats) {
+    stats.print(cout, players);
+  }
+}
 
 //Reads in data from terminal, parsing data into variables.
 int main(int argc, char **argv) {
@@ -47,11 +126,15 @@ int main(int argc, char **argv) {
     cout << " " << argv[i];
   }
   cout << " " << endl;  // Space before newline
+
+#ifdef TIME_PHASES
+  // Built to time its phases, see PhaseTimer.hpp.  The report goes to cerr,
+  // so the transcript is the same as ever.
+  atexit([] { print_phase_times(std::cerr); });
+#endif
   
-  bool shuffle = false;
-  
-  if (argc != 12){
-    cout << err_msg << err_msg2 << endl;
+  if (argc < 12 || argc > 16){
+    cout << err_msg << err_msg2 << err_msg3 << endl;
     return 1;
   }
 
@@ -63,277 +146,73 @@ int main(int argc, char **argv) {
     return 1;
   }
   
-  if (argv[2] == string("shuffle")){
-    shuffle = true;
-  }
- 
-  else if (argv[2] != string("shuffle") && argv[2] != string("noshuffle")){
-    cout << err_msg << err_msg2 << endl;
+  ShuffleSetting shuffle;
+  if (!parse_shuffle(argv[2], shuffle)){
+    cout << err_msg << err_msg2 << err_msg3 << endl;
     return 1;
   }
 
   int points_to_win = stoi(argv[3]);
   if(!(points_to_win > 0 && points_to_win <= 100)){
-    cout << err_msg << err_msg2 << endl;
+    cout << err_msg << err_msg2 << err_msg3 << endl;
+    return 1;
+  }
+
+  Options options;
+  bool bad_options = !parse_options(argc, argv, options);
+  // Options other than log= only make sense for batch games
+  bool batch = options.num_games > 0;
+  bad_options = bad_options ||
+    (argc > 12 && options.log_filename.empty() && !batch);
+  bad_options = bad_options || (options.print_stats && !batch);
+  if (options.num_games < 0 || options.num_threads < 1 || bad_options) {
+    cout << err_msg << err_msg2 << err_msg3 << endl;
     return 1;
   }
 
   vector<Player*> players;
-  for (int i = 4; i < argc; i += 2){
+  vector<string> types;
+  for (int i = 4; i < 12; i += 2){
     string name = argv[i];
     string type = argv[i + 1];
-    if (type == "Simple"){
-      Player* player = Player_factory(name, "Simple");
-      players.push_back(player);
-    }
-    else if (type == "Human"){
-      Player* player = Player_factory(name, "Human");
-      players.push_back(player);
+    // Human players read from cin, so they can only play a single game
+    if (Player_strategy_exists(type) && (type != "Human" || !batch)){
+      players.push_back(Player_factory(name, type));
+      types.push_back(type);
     }
     else{
-      cout << err_msg << err_msg2 << endl;
+      cout << err_msg << err_msg2 << err_msg3 << endl;
+      for (size_t j = 0; j < players.size(); ++j) {
+        delete players[j];
+      }
       return 1;
     }
   }
-  Game game(pack_filename, shuffle, points_to_win, players);
-  game.play();
-}
-
-//Creates an instance of game.
-Game::Game(const string &pack_filename, bool shuffle_setting, int points, 
-  vector<Player*>& players)
-    : pack(), players(players), points_to_win(points), dealer(0), 
-    scores(2, 0), shuffle_deck(shuffle_setting) {  
-    ifstream file(pack_filename);
-    if (!file) {
-        cerr << "Error opening file: " << pack_filename << endl;
-        exit(1);
-    }
-
-    pack = Pack(file);  
-}
 
-void Game::play(){
-  //loop until a team wins
-  while(this->scores[0] < this->points_to_win && this->scores[1] < this->points_to_win){
-    cout << "Hand " << hand << endl;
-    cout << players[dealer]->get_name() << " deals" << endl;
-    
-    if(shuffle_deck) {
-      shuffle();
-    } else{
-      pack.reset(); 
+  GameSetup setup = { Pack(file), shuffle, points_to_win };
+  if (batch) {
+    play_batch(setup, players, types, options);
+  } else {
+    // Human players prompt on cout, so the transcript must not lag behind
+    bool interactive = false;
+    for (const string &type : types) {
+      interactive = interactive || type == "Human";
+    }
+    StdoutSink out(interactive);
+    Game game(setup, players, out);
+    GameLog log;
+    if (!options.log_filename.empty()) {
+      game.set_log(&log);
+    }
+    game.play();
+    out.flush();
+    if (!options.log_filename.empty()) {
+      ofstream log_file(options.log_filename, ios::binary);
+      log.write(log_file);
     }
-
-    deal();
-    make_trump();
-    play_hand();
-    print_scores();
-    dealer = (dealer + 1) % 4;
-    hand++;
   }
-  print_winner();
+
   for (size_t i = 0; i < players.size(); ++i) {
     delete players[i];
   }
 }
-
-//Accesses the private player vector to set the new variables.
-void Game::set_players(const vector<Player*>& new_players){
-    players = new_players;
-}
-
-void Game::shuffle(){
-  pack.shuffle();
-}
-
-//3-2-3-2 order
-void Game::deal() {
-    // Deal first round: 3, 2, 3, 2
-    // Starting with player to the left of the dealer
-    
-    // First deal 3 cards to first player
-    int current_player = (dealer + 1) % 4;
-    for(int i = 0; i < 3; i++) {
-        Card dealt = pack.deal_one();
-        players[current_player]->add_card(dealt);
-    }
-    
-    // Deal 2 cards to second player
-    current_player = (dealer + 2) % 4;
-    for(int i = 0; i < 2; i++) {
-        Card dealt = pack.deal_one();
-        players[current_player]->add_card(dealt);
-    }
-    
-    // Deal 3 cards to third player
-    current_player = (dealer + 3) % 4;
-    for(int i = 0; i < 3; i++) {
-        Card dealt = pack.deal_one();
-        players[current_player]->add_card(dealt);
-    }
-    
-    // Deal 2 cards to dealer
-    current_player = dealer;
-    for(int i = 0; i < 2; i++) {
-        Card dealt = pack.deal_one();
-        players[current_player]->add_card(dealt);
-    }
-    
-    // Second round: 2, 3, 2, 3
-    // Deal 2 cards to first player
-    current_player = (dealer + 1) % 4;
-    for(int i = 0; i < 2; i++) {
-        Card dealt = pack.deal_one();
-        players[current_player]->add_card(dealt);
-    }
-    
-    // Deal 3 cards to second player
-    current_player = (dealer + 2) % 4;
-    for(int i = 0; i < 3; i++) {
-        Card dealt = pack.deal_one();
-        players[current_player]->add_card(dealt);
-    }
-    
-    // Deal 2 cards to third player
-    current_player = (dealer + 3) % 4;
-    for(int i = 0; i < 2; i++) {
-        Card dealt = pack.deal_one();
-        players[current_player]->add_card(dealt);
-    }
-    
-    // Deal 3 cards to dealer
-    current_player = dealer;
-    for(int i = 0; i < 3; i++) {
-        Card dealt = pack.deal_one();
-        players[current_player]->add_card(dealt);
-    }
-}
-
-void Game::make_trump(){
-  Card upcard = pack.deal_one();
-  cout << upcard << " turned up" << endl;
-  
-  bool trump_chosen = false;
-  
-  // Round 1
-  for(int i = 1; i <= 4; ++i) {
-    int current_player = (dealer + i) % 4;
-    bool is_dealer = (current_player == dealer);
-    
-    if(players[current_player]->make_trump(upcard, is_dealer, 1, trump)) {
-      cout << players[current_player]->get_name() << " orders up " << trump << endl;
-      trump_team = current_player % 2;
-      players[dealer]->add_and_discard(upcard);
-      trump_chosen = true;
-      cout << endl;  // Extra newline after making trump
-      break;
-    } else {
-      cout << players[current_player]->get_name() << " passes" << endl;
-    }
-  }
-  
-  // Round 2 if needed
-  if(trump_chosen) {
-    return; // Early return to avoid nested block
-  }
-  
-  // Continue with round 2
-  for(int i = 1; i <= 4; ++i) {
-    int current_player = (dealer + i) % 4;
-    bool is_dealer = (current_player == dealer);
-    
-    if(players[current_player]->make_trump(upcard, is_dealer, 2, trump)) {
-      cout << players[current_player]->get_name() << " orders up " << trump << endl;
-      trump_team = current_player % 2;
-      cout << endl;
-      return; // Exit after trump is chosen
-    }
-    
-    cout << players[current_player]->get_name() << " passes" << endl;
-    
-    // Handle dealer separately
-    if(is_dealer) {
-      trump = Suit_next(upcard.get_suit());
-      cout << players[dealer]->get_name() << " must order up " << trump << endl;
-      trump_team = dealer % 2;
-      cout << endl;
-    }
-  }
-}
-
-void Game::play_hand(){
-  vector<int> tricks_won(2, 0);
-  int leader = (dealer + 1) % 4;
-
-  for (int trick = 0; trick < 5; trick++) {
-    // Lead
-    Card led_card = players[leader]->lead_card(trump);
-    cout << led_card << " led by " << players[leader]->get_name() << endl;
-    
-    // Play remaining cards
-    Card highest_card = led_card;
-    int winner = leader;
-    
-    for(int i = 1; i < 4; i++) {
-      int current_player = (leader + i) % 4;
-      Card played = players[current_player]->play_card(led_card, trump);
-      cout << played << " played by " << players[current_player]->get_name() << endl;
-      
-      if(Card_less(highest_card, played, led_card, trump)) {
-        highest_card = played;
-        winner = current_player;
-      }
-    }
-    
-    cout << players[winner]->get_name() << " takes the trick" << endl;
-    cout << endl;  // Extra newline after each trick
-    
-    tricks_won[winner % 2]++;
-    leader = winner;
-  }
-  update_scores(tricks_won);
-}
-
-void Game::update_scores(const vector<int>& tricks_won){
-  //cout << trump_team << endl;
-  if (tricks_won[trump_team] >= 3) {
-    cout << players[trump_team]->get_name() << " and " 
-         << players[trump_team + 2]->get_name() << " win the hand" << endl;
-    if(tricks_won[trump_team] == 5) {
-      scores[trump_team] += 2;
-      cout << "march!" << endl;
-    } else {
-      scores[trump_team] += 1;
-    }
-  } else {
-    cout << players[1 - trump_team]->get_name() << " and " 
-         << players[(1 - trump_team) + 2]->get_name() << " win the hand" << endl;
-    scores[1 - trump_team] += 2;
-    cout << "euchred!" << endl;
-  }
-}
-
-void Game::print_scores(){
-  cout << players[0]->get_name() << " and " << players[2]->get_name() 
-  << " have " << scores[0] << " points" << endl;
-  cout << players[1]->get_name() << " and " << players[3]->get_name() 
-  << " have " << scores[1] << " points" << endl;
-  cout << endl;  // Extra newline after scores
-}
-
-void Game::print_winner(){
-  //cout << endl;  // Extra newline before winner
-  if (scores[0] >= this->points_to_win) {
-    cout << players[0]->get_name() << " and " << players[2]->get_name() << " win!" << 
-    endl;
-  } else {
-    cout << players[1]->get_name() << " and " << players[3]->get_name() << " win!" << 
-    endl;
-  }
-}
-
-// Getter method implementation
-const vector<Player*>& Game::get_players() const {
-  return players;
-}
\ No newline at end of file
@@ -0,0 +1,182 @@
+#include "Game.hpp"
+#include "OutputSink.hpp"
+#include "Pack.hpp"
+#include "Player.hpp"
+#include <chrono>
+#include <cstdlib>
+#include <fstream>
+#include <iomanip>
+#include <iostream>
+#include <sstream>
+#include <streambuf>
+#include <string>
+#include <sys/resource.h>
+#include <vector>
+using namespace std;
+
+string usage = "Usage: macro_bench.exe [--json] [games=NUM_GAMES]";
+
+// Files the workloads read, from the directory the benchmark runs in
+const string PACK_FILENAME = "pack.in";
+const string HUMAN_SCRIPT_FILENAME = "euchre_test50.in";
+
+// A fixed set of games played through Game, like a run of euchre.exe
+struct Workload {
+  string name;
+  ShuffleSetting::Mode shuffle;
+  int points_to_win;
+  string strategy;   // of all four players
+  long long games;   // by default
+};
+
+const Workload WORKLOADS[] = {
+  { "simple_noshuffle", ShuffleSetting::NO_SHUFFLE, 10, "Simple", 20000 },
+  { "simple_shuffle", ShuffleSetting::IN_SHUFFLE, 10, "Simple", 20000 },
+  // The players read their moves from the script of euchre_test50, one
+  // whole game per run through it
+  { "human_scripted", ShuffleSetting::NO_SHUFFLE, 3, "Human", 5000 },
+};
+
+struct Measurement {
+  string name;
+  long long games;
+  long long hands;
+  double seconds;
+  long peak_rss_kb;
+};
+
+// Swallows the Human players' prompts
+class NullBuffer : public streambuf {
+protected:
+  int overflow(int c) override {
+    return c;
+  }
+};
+
+//EFFECTS Returns the largest resident set size of the process so far, in
+//  kilobytes
+long peak_rss_kb() {
+  rusage usage;
+  getrusage(RUSAGE_SELF, &usage);
+#ifdef __APPLE__
+  // macOS reports bytes, Linux kilobytes
+  return usage.ru_maxrss / 1024;
+#else
+  return usage.ru_maxrss;
+#endif
+}
+
+//EFFECTS Returns the whole contents of the file, or "" if it cannot be read
+string read_file(const string &filename) {
+  ifstream file(filename);
+  ostringstream contents;
+  contents << file.rdbuf();
+  return contents.str();
+}
+
+//EFFECTS Plays games of workload from pack and times them.  If script is
+//  not empty, it is what cin reads at the start of every game.
+Measurement run(const Workload &workload, long long games, const Pack &pack,
+                const string &script) {
+  const char *names[] = { "Ivan", "Judea", "Kunle", "Liskov" };
+  vector<Player*> players;
+  for (const char *name : names) {
+    players.push_back(Player_factory(name, workload.strategy));
+  }
+  ShuffleSetting shuffle = { workload.shuffle, 0, 0 };
+  NullSink discard;
+  NullBuffer null_buffer;
+  streambuf *cout_buffer = cout.rdbuf(&null_buffer);
+  streambuf *cin_buffer = cin.rdbuf();
+
+  Measurement measurement = { workload.name, games, 0, 0, 0 };
+  auto start = chrono::steady_clock::now();
+  for (long long i = 0; i < games; ++i) {
+    istringstream input(script);
+    if (!script.empty()) {
+      cin.rdbuf(input.rdbuf());
+    }
+    Game game({ pack, shuffle, workload.points_to_win }, players, discard);
+    measurement.hands += game.play().hands;
+  }
+  measurement.seconds =
+    chrono::duration<double>(chrono::steady_clock::now() - start).count();
+  measurement.peak_rss_kb = peak_rss_kb();
+
+  cin.rdbuf(cin_buffer);
+  cout.rdbuf(cout_buffer);
+  for (Player *player : players) {
+    delete player;
+  }
+  return measurement;
+}
+
+void print_text(const vector<Measurement> &measurements) {
+  cout << left << setw(20) << "workload" << right << setw(10) << "games"
+       << setw(10) << "hands" << setw(10) << "seconds" << setw(12)
+       << "games/s" << setw(12) << "hands/s" << setw(14) << "peak RSS KiB"
+       << '\n';
+  for (const Measurement &m : measurements) {
+    cout << left << setw(20) << m.name << right << setw(10) << m.games
+         << setw(10) << m.hands << fixed << setprecision(3)
+         << setw(10) << m.seconds << setprecision(0)
+         << setw(12) << m.games / m.seconds
+         << setw(12) << m.hands / m.seconds
+         << setw(14) << m.peak_rss_kb << '\n';
+  }
+}
+
+void print_json(const vector<Measurement> &measurements) {
+  cout << "{\"workloads\": [";
+  for (size_t i = 0; i < measurements.size(); ++i) {
+    const Measurement &m = measurements[i];
+    cout << (i > 0 ? ", " : "") << fixed << setprecision(6)
+         << "{\"name\": \"" << m.name << "\", \"games\": " << m.games
+         << ", \"hands\": " << m.hands << ", \"seconds\": " << m.seconds
+         << ", \"games_per_sec\": " << m.games / m.seconds
+         << ", \"hands_per_sec\": " << m.hands / m.seconds
+         << ", \"peak_rss_kb\": " << m.peak_rss_kb << "}";
+  }
+  cout << "], \"peak_rss_kb\": " << peak_rss_kb() << "}" << endl;
+}
+
+//Plays each workload's games through Game and reports games/s, hands/s
+//and the peak resident set size of the process after each workload, as a
+//table or, with --json, as one JSON object.  games= plays that many games
+//of every workload instead of the defaults.
+int main(int argc, char **argv) {
+  bool json = false;
+  long long games = 0;
+  for (int i = 1; i < argc; ++i) {
+    string arg = argv[i];
+    if (arg == "--json") {
+      json = true;
+    } else if (arg.compare(0, 6, "games=") == 0 && atoll(argv[i] + 6) > 0) {
+      games = atoll(argv[i] + 6);
+    } else {
+      cout << usage << endl;
+      return 1;
+    }
+  }
+
+  ifstream pack_file(PACK_FILENAME);
+  string script = read_file(HUMAN_SCRIPT_FILENAME);
+  if (!pack_file || script.empty()) {
+    cout << "Error opening " << PACK_FILENAME << " or "
+         << HUMAN_SCRIPT_FILENAME << endl;
+    return 1;
+  }
+  Pack pack(pack_file);
+
+  vector<Measurement> measurements;
+  for (const Workload &workload : WORKLOADS) {
+    bool human = workload.strategy == "Human";
+    measurements.push_back(run(workload, games > 0 ? games : workload.games,
+                               pack, human ? script : ""));
+  }
+  if (json) {
+    print_json(measurements);
+  } else {
+    print_text(measurements);
+  }
+}
@@ -0,0 +1,47 @@
+#include "GameLog.hpp"
+#include "OutputSink.hpp"
+#include "Replay.hpp"
+#include <cstdlib>
+#include <fstream>
+#include <iostream>
+#include <string>
+using namespace std;
+
+string usage = "Usage: replay.exe LOG_FILENAME [GAME_NUMBER]";
+
+//Prints the transcripts of the games in a binary log written by
+//euchre.exe, or only the game with the given number, counting from 0.
+//Stops with an error at the first game that cannot be read or replayed.
+int main(int argc, char **argv) {
+  if (argc < 2 || argc > 3) {
+    cout << usage << endl;
+    return 1;
+  }
+  ifstream file(argv[1], ios::binary);
+  if (!file) {
+    cout << "Error opening file" << endl;
+    return 1;
+  }
+  long long only_game = argc == 3 ? atoll(argv[2]) : -1;
+
+  StdoutSink out;
+  GameLog log;
+  long long game = 0;
+  for (; file.peek() != EOF; ++game) {
+    if (!log.read(file)) {
+      out.flush();
+      cout << "Corrupt game " << game << endl;
+      return 1;
+    }
+    if ((only_game < 0 || game == only_game) && !replay_game(log, out)) {
+      out.flush();
+      cout << "Game " << game << " is not a finished game" << endl;
+      return 1;
+    }
+  }
+  out.flush();
+  if (only_game >= game) {
+    cout << "Log has only " << game << " games" << endl;
+    return 1;
+  }
+}